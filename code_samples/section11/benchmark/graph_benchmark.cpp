@@ -0,0 +1,438 @@
+/*
+    graph_benchmark.cpp
+    -------------------
+    Adjacency list (vector<vector<int>>) vs CSR (../common/csr_graph.hpp)
+    on large random graphs, using the functions from the lesson and the
+    problem files themselves (their main() functions are left out).
+
+    For each representation:
+
+        build         build_graph / build_graph_csr from the same edge list
+                      (time, and bytes held by the graph)
+        bfs           bfs_shortest (lesson) and bfsShortestPaths (11_1)
+                      from node 0; edges/s = adjacency entries scanned
+        components    connectedComponents (11_2), CSR only: the recursive
+                      adjacency-list DFS overflows the stack at this size
+        topo          topo_sort (lesson) on a random DAG (edges u -> v, u < v)
+        dijkstra      dijkstra (11_4) on a directed graph, weights 1..100
+        sssp grid     dijkstra (11_4) with each DijkstraQueue strategy on a
+        sssp random   road-like square grid (~n vertices, undirected), on
+        sssp dense    a random directed graph (weights 1..100) and on a
+                      dense 4000-vertex graph (~8M edges, weights 1..1000);
+                      MB = peak memory allocated during the search
+        rmat bfs      bfsShortestPaths (CSR) vs bfsDirectionOptimizing
+                      (11_1) on an undirected R-MAT graph with 2^ceil(log2 n)
+                      vertices, from 8 random non-isolated sources;
+                      M edges/s counts the edges in the searched component
+                      (Graph500 TEPS), the same for both
+        parallel bfs  bfs_shortest_parallel (lesson) on the undirected
+                      uniform and R-MAT graphs with 1, 2, 4, ... threads
+                      up to maxThreads, against bfs_shortest (CSR)
+
+    Both representations (and, for rmat bfs, both algorithms) must produce
+    identical results; any difference is reported and makes the program
+    exit with status 1.
+
+    Memory for vector<vector<int>> counts each vector's 24-byte header plus
+    its capacity (push_back leaves spare room); the allocator's own
+    per-block overhead (~16 bytes per non-empty list) comes on top.
+
+    USAGE
+    -----
+        graph_benchmark [n] [m] [maxThreads]
+            n           vertices   (default 1,000,000)
+            m           edges      (default 10,000,000; undirected graphs
+                                   store each edge twice)
+            maxThreads  for parallel bfs (default: hardware threads)
+
+    BUILD (from this folder)
+    -----
+        g++ -std=c++17 -O2 -pthread graph_benchmark.cpp -o graph_benchmark
+*/
+
+// Every header the included files use, included once at global scope, so
+// the #includes inside them below are no-ops in their namespaces.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../common/csr_graph.hpp"
+#include "../common/graph_generators.hpp"
+
+#define SECTION11_NO_MAIN
+namespace lesson {
+#include "../lesson/section11.cpp"
+}
+namespace p1 {
+#include "../problems/problem11_1/problem11_1.cpp"
+}
+namespace p2 {
+#include "../problems/problem11_2/problem11_2.cpp"
+}
+namespace p3 {
+#include "../problems/problem11_3/problem11_3.cpp"
+}
+namespace p4 {
+#include "../problems/problem11_4/problem11_4.cpp"
+}
+#undef SECTION11_NO_MAIN
+
+using namespace std;
+
+// ------------------------------------------------------------
+// Helpers
+// ------------------------------------------------------------
+template <class F>
+static double timeMs(F f)
+{
+    auto t0 = chrono::steady_clock::now();
+    f();
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(t1 - t0).count();
+}
+
+// ------------------------------------------------------------
+// Allocation tracking: every operator new / delete in the program goes
+// through these, so peakAllocated() can report the most memory a call
+// had allocated at any one time (e.g. a priority queue at its largest).
+// ------------------------------------------------------------
+static atomic<size_t> liveBytes(0), peakBytes(0);
+
+void* operator new(size_t size)
+{
+    // 16-byte header remembers the size (and keeps 16-byte alignment)
+    size_t* block = (size_t*)malloc(size + 16);
+    if (!block) throw bad_alloc();
+    block[0] = size;
+
+    size_t live = liveBytes.fetch_add(size, memory_order_relaxed) + size;
+    size_t peak = peakBytes.load(memory_order_relaxed);
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live, memory_order_relaxed)) {}
+    return (char*)block + 16;
+}
+
+// noinline: once inlined into a caller, GCC sees p - 16 on an object it
+// knows and warns (-Warray-bounds, -Wmismatched-new-delete)
+[[gnu::noinline]] void operator delete(void* p) noexcept
+{
+    if (!p) return;
+    size_t* block = (size_t*)((char*)p - 16);
+    liveBytes.fetch_sub(block[0], memory_order_relaxed);
+    free(block);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+// Peak bytes allocated while f() runs, above what was live before it
+template <class F>
+static size_t peakAllocated(F f)
+{
+    size_t before = liveBytes.load();
+    peakBytes.store(before);
+    f();
+    return peakBytes.load() - before;
+}
+
+template <class T>
+static size_t adjacencyBytes(const vector<vector<T>>& adj)
+{
+    size_t bytes = adj.capacity() * sizeof(vector<T>);
+    for (const auto& list : adj) bytes += list.capacity() * sizeof(T);
+    return bytes;
+}
+
+// Adjacency entries scanned by a BFS: the degrees of every reached node
+static long long scannedEdges(const CsrGraph& g, const vector<int>& dist, int unreached)
+{
+    long long edges = 0;
+    for (int u = 0; u < g.n; u++) {
+        if (dist[u] != unreached) edges += g.degree(u);
+    }
+    return edges;
+}
+
+static void printRow(const string& op, const string& rep, double ms,
+                     double bytes, long long edges, bool ok)
+{
+    cout << left << setw(12) << op << setw(14) << rep << right
+         << setw(11) << fixed << setprecision(1) << ms;
+    if (bytes > 0) cout << setw(12) << bytes / (1024.0 * 1024.0);
+    else           cout << setw(12) << "-";
+    if (edges > 0) cout << setw(14) << setprecision(1) << edges / (ms / 1000.0) / 1e6;
+    else           cout << setw(14) << "-";
+    cout << setw(8) << (ok ? "OK" : "DIFF") << "\n";
+}
+
+static bool everythingOk = true;
+
+static void check(bool ok)
+{
+    everythingOk = everythingOk && ok;
+}
+
+// ------------------------------------------------------------
+// Benchmarks
+// ------------------------------------------------------------
+static void benchUndirected(int n, long long m, mt19937_64& rng)
+{
+    vector<pair<int,int>> edges(m);
+    for (auto& e : edges) e = { (int)(rng() % n), (int)(rng() % n) };
+
+    vector<vector<int>> adj;
+    CsrGraph csr;
+    double buildList = timeMs([&] { adj = lesson::build_graph(n, edges); });
+    double buildCsr  = timeMs([&] { csr = lesson::build_graph_csr(n, edges); });
+    printRow("build", "vector<vector>", buildList, (double)adjacencyBytes(adj), 0, true);
+    printRow("build", "CSR", buildCsr, (double)csr.memoryBytes(), 0, true);
+
+    // Lesson BFS
+    vector<int> distList, distCsr;
+    double bfsList = timeMs([&] { lesson::bfs_shortest(n, adj, 0, distList); });
+    double bfsCsr  = timeMs([&] { lesson::bfs_shortest(n, csr, 0, distCsr); });
+    long long scanned = scannedEdges(csr, distCsr, INT_MAX / 4);
+    bool ok = distList == distCsr;
+    check(ok);
+    printRow("bfs", "vector<vector>", bfsList, 0, scanned, ok);
+    printRow("bfs", "CSR", bfsCsr, 0, scanned, ok);
+
+    // Problem 11_1 BFS
+    vector<int> d1List, d1Csr;
+    double p1List = timeMs([&] { d1List = p1::bfsShortestPaths(n, adj, 0); });
+    double p1Csr  = timeMs([&] { d1Csr = p1::bfsShortestPaths(n, csr, 0); });
+    ok = d1List == d1Csr;
+    check(ok);
+    printRow("bfs (11_1)", "vector<vector>", p1List, 0, scanned, ok);
+    printRow("bfs (11_1)", "CSR", p1Csr, 0, scanned, ok);
+
+    // Components: CSR only (the adjacency-list versions recurse per node)
+    vector<int> comp;
+    int count = 0;
+    double compCsr = timeMs([&] { count = p2::connectedComponents(n, csr, comp); });
+    ok = count == lesson::count_components(n, csr);
+    check(ok);
+    printRow("components", "CSR", compCsr, 0, csr.edgeCount(), ok);
+}
+
+static void benchDag(int n, long long m, mt19937_64& rng)
+{
+    vector<pair<int,int>> edges(m);
+    for (auto& e : edges) {
+        int a = (int)(rng() % n), b = (int)(rng() % n);
+        if (a == b) b = (b + 1) % n;
+        e = { min(a, b), max(a, b) };
+    }
+
+    vector<vector<int>> adj(n);
+    for (auto [u, v] : edges) adj[u].push_back(v);
+    CsrGraph csr = buildCsr(n, edges, false);
+
+    vector<int> orderList, orderCsr;
+    double list = timeMs([&] { lesson::topo_sort(n, adj, orderList); });
+    double flat = timeMs([&] { lesson::topo_sort(n, csr, orderCsr); });
+    bool ok = orderList == orderCsr && (int)orderCsr.size() == n;
+
+    vector<int> k3List, k3Csr;
+    double kahnList = timeMs([&] { k3List = p3::topoSortKahn(n, adj); });
+    double kahnCsr  = timeMs([&] { k3Csr = p3::topoSortKahn(n, csr); });
+    ok = ok && k3List == k3Csr && k3Csr == orderCsr;
+    check(ok);
+
+    printRow("topo", "vector<vector>", list, (double)adjacencyBytes(adj), m, ok);
+    printRow("topo", "CSR", flat, (double)csr.memoryBytes(), m, ok);
+    printRow("topo (11_3)", "vector<vector>", kahnList, 0, m, ok);
+    printRow("topo (11_3)", "CSR", kahnCsr, 0, m, ok);
+}
+
+static void benchDijkstra(int n, long long m, mt19937_64& rng)
+{
+    vector<WeightedEdge> edges(m);
+    for (auto& e : edges) e = { (int)(rng() % n), (int)(rng() % n), (int)(1 + rng() % 100) };
+
+    vector<vector<p4::Edge>> adj(n);
+    for (const auto& e : edges) p4::addEdge(adj, e.u, e.v, e.w);
+    CsrGraph csr = buildCsrWeighted(n, edges, false);
+
+    vector<int> distList, distCsr;
+    double list = timeMs([&] { distList = p4::dijkstra(n, adj, 0); });
+    double flat = timeMs([&] { distCsr = p4::dijkstra(n, csr, 0); });
+    bool ok = distList == distCsr;
+    check(ok);
+
+    printRow("dijkstra", "vector<vector>", list, (double)adjacencyBytes(adj), m, ok);
+    printRow("dijkstra", "CSR", flat, (double)csr.memoryBytes(), m, ok);
+}
+
+// Binary heap vs Dial vs radix heap (11_4), all on CSR
+// Binary heap vs Dial vs radix heap vs indexed 4-ary heap (11_4), all on
+// CSR; the MB column is the peak memory allocated during the call
+static void benchQueues(const string& op, const CsrGraph& g, int src)
+{
+    struct Strategy {
+        const char* name;
+        p4::DijkstraQueue queue;
+    };
+    const Strategy strategies[] = {
+        { "binary heap",  p4::DijkstraQueue::BinaryHeap },
+        { "dial",         p4::DijkstraQueue::Dial },
+        { "radix heap",   p4::DijkstraQueue::RadixHeap },
+        { "indexed 4ary", p4::DijkstraQueue::IndexedHeap },
+    };
+
+    vector<int> reference;
+    for (const auto& st : strategies) {
+        vector<int> dist;
+        size_t peak = 0;
+        double ms = timeMs([&] {
+            peak = peakAllocated([&] { dist = p4::dijkstra(g.n, g, src, st.queue); });
+        });
+        if (reference.empty()) reference = dist;
+        bool ok = dist == reference;
+        check(ok);
+        printRow(op, st.name, ms, (double)peak, g.edgeCount(), ok);
+    }
+}
+
+static void benchDijkstraQueues(int n, long long m, mt19937_64& rng)
+{
+    // Road-like: square grid with ~n vertices, undirected, travel times 1..100
+    int side = 1;
+    while ((long long)side * side < n) side++;
+    {
+        vector<WeightedEdge> edges;
+        for (auto [u, v] : gridEdges(side, side)) edges.push_back({ u, v, (int)(1 + rng() % 100) });
+        benchQueues("sssp grid", buildCsrWeighted(side * side, edges, true), 0);
+    }
+
+    // Random directed graph, weights 1..100
+    {
+        vector<WeightedEdge> edges(m);
+        for (auto& e : edges) e = { (int)(rng() % n), (int)(rng() % n), (int)(1 + rng() % 100) };
+        benchQueues("sssp random", buildCsrWeighted(n, edges, false), 0);
+    }
+
+    // Dense: every ordered pair with probability 1/2 - where lazy deletion
+    // lets the binary heap collect far more entries than there are vertices
+    {
+        int dense = 4000;
+        vector<WeightedEdge> edges;
+        for (int u = 0; u < dense; u++) {
+            for (int v = 0; v < dense; v++) {
+                uint64_t r = rng();
+                if (u != v && (r & 1)) edges.push_back({ u, v, (int)(1 + (r >> 1) % 1000) });
+            }
+        }
+        benchQueues("sssp dense", buildCsrWeighted(dense, edges, false), 0);
+    }
+}
+
+static void benchRmat(int n, long long m, mt19937_64& rng)
+{
+    int scale = 1;
+    while ((1 << scale) < n) scale++;
+    CsrGraph g = buildCsr(1 << scale, rmatEdges(scale, m, rng()), true);
+
+    double plainMs = 0, fastMs = 0;
+    long long traversed = 0, plainExamined = 0;
+    p1::BfsStats total;
+    bool ok = true;
+
+    for (int run = 0; run < 8; run++) {
+        int src;
+        do { src = (int)(rng() % g.n); } while (g.degree(src) == 0);
+
+        vector<int> plain, fast;
+        p1::BfsStats stats;
+        plainMs += timeMs([&] { plain = p1::bfsShortestPaths(g.n, g, src); });
+        fastMs  += timeMs([&] { fast = p1::bfsDirectionOptimizing(g, src, &stats); });
+        ok = ok && plain == fast;
+
+        long long component = scannedEdges(g, plain, -1);
+        traversed += component;
+        plainExamined += component;  // top-down looks at every one of them
+        total.edgesExamined += stats.edgesExamined;
+        total.topDownSteps += stats.topDownSteps;
+        total.bottomUpSteps += stats.bottomUpSteps;
+    }
+    check(ok);
+
+    printRow("rmat bfs", "top-down", plainMs, (double)g.memoryBytes(), traversed, ok);
+    printRow("rmat bfs", "direction-opt", fastMs, 0, traversed, ok);
+    cout << "  R-MAT scale " << scale << ": edges examined top-down " << plainExamined
+         << ", direction-optimizing " << total.edgesExamined
+         << " (" << total.topDownSteps << " top-down + " << total.bottomUpSteps
+         << " bottom-up steps over 8 searches)\n";
+}
+
+static void benchParallelBfs(int n, long long m, int maxThreads, mt19937_64& rng)
+{
+    int scale = 1;
+    while ((1 << scale) < n) scale++;
+
+    vector<pair<string, CsrGraph>> graphs;
+    graphs.push_back({ "uniform", buildCsr(n, uniformEdges(n, m, rng()), true) });
+    graphs.push_back({ "R-MAT", buildCsr(1 << scale, rmatEdges(scale, m, rng()), true) });
+
+    for (const auto& [name, g] : graphs) {
+        int src;
+        do { src = (int)(rng() % g.n); } while (g.degree(src) == 0);
+
+        vector<int> expected, got;
+        double seq = timeMs([&] { lesson::bfs_shortest(g.n, g, src, expected); });
+        long long traversed = scannedEdges(g, expected, INT_MAX / 4);
+        printRow("par bfs", name + " seq", seq, 0, traversed, true);
+
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            double ms = timeMs([&] { lesson::bfs_shortest_parallel(g.n, g, src, got, threads); });
+            bool ok = got == expected;
+            check(ok);
+            printRow("par bfs", name + " " + to_string(threads) + "t", ms, 0, traversed, ok);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    long long m = argc > 2 ? atoll(argv[2]) : 10000000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : (int)max(1u, thread::hardware_concurrency());
+    if (n < 2 || m < 1) {
+        cerr << "usage: graph_benchmark [n >= 2] [m >= 1]\n";
+        return 1;
+    }
+
+    cout << "n = " << n << " vertices, m = " << m << " edges, up to "
+         << maxThreads << " threads (" << thread::hardware_concurrency() << " hardware)\n\n";
+    cout << left << setw(12) << "operation" << setw(14) << "graph" << right
+         << setw(11) << "ms" << setw(12) << "MB" << setw(14) << "M edges/s"
+         << setw(8) << "check" << "\n";
+
+    mt19937_64 rng(11);
+    benchUndirected(n, m, rng);
+    benchDag(n, m, rng);
+    benchDijkstra(n, m, rng);
+    benchDijkstraQueues(n, m, rng);
+    benchRmat(n, m, rng);
+    benchParallelBfs(n, m, maxThreads, rng);
+
+    cout << "\n" << (everythingOk ? "SUCCESS — both representations agree."
+                                  : "FAIL — see DIFF rows above.") << "\n";
+    return everythingOk ? 0 : 1;
+}
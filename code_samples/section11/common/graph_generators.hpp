@@ -0,0 +1,122 @@
+/*
+ * graph_generators.hpp
+ * --------------------
+ * Synthetic edge lists for testing and benchmarking the section11 graph
+ * code on graphs far larger than the hand-written test cases.
+ *
+ *   rmatEdges(scale, m, seed)
+ *       R-MAT (recursive matrix) graph, the Graph500 generator: 2^scale
+ *       vertices, m edges. Every edge picks one quadrant of the adjacency
+ *       matrix per bit of its (u, v) pair with probabilities
+ *       a = 0.57, b = 0.19, c = 0.19, d = 0.05, giving a skewed
+ *       (power-law-like) degree distribution and a small diameter - the
+ *       shape of social and web graphs. Vertex ids are randomly permuted
+ *       afterwards so that high-degree vertices are not all near 0.
+ *
+ *   uniformEdges(n, m, seed)
+ *       Erdos-Renyi style: both endpoints uniformly random.
+ *
+ *   gridEdges(width, height)
+ *       width x height grid, each vertex joined to its right and lower
+ *       neighbour: the sparse, planar, large-diameter shape of a road
+ *       network (pair with random weights for travel times).
+ *
+ * Self-loops and duplicate edges are kept (as real edge lists often have).
+ */
+
+#ifndef SECTION11_GRAPH_GENERATORS_HPP
+#define SECTION11_GRAPH_GENERATORS_HPP
+
+#include <algorithm>  // std::shuffle
+#include <cstdint>    // uint64_t
+#include <numeric>    // std::iota
+#include <random>     // std::mt19937_64
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+/*
+ * rmatEdges
+ * ---------
+ * Parameters:
+ *   scale : log2 of the number of vertices
+ *   m     : number of edges to generate
+ *   seed  : random seed (same seed -> same graph)
+ *
+ * Returns:
+ *   m (u, v) pairs with 0 <= u, v < 2^scale
+ */
+inline std::vector<std::pair<int,int>> rmatEdges(int scale, long long m, uint64_t seed) {
+    // Quadrant thresholds on a 16-bit random number: a | b | c | d
+    const uint32_t A = (uint32_t)(0.57 * 65536);
+    const uint32_t AB = (uint32_t)(0.76 * 65536);
+    const uint32_t ABC = (uint32_t)(0.95 * 65536);
+
+    std::mt19937_64 rng(seed);
+    std::vector<std::pair<int,int>> edges((size_t)m);
+
+    for (auto& e : edges) {
+        int u = 0, v = 0;
+        uint64_t bits = 0;
+        for (int level = 0; level < scale; level++) {
+            if (level % 4 == 0) bits = rng();          // 4 decisions per 64-bit draw
+            uint32_t r = (uint32_t)(bits & 0xFFFF);
+            bits >>= 16;
+            int right = (r >= A && r < AB) || r >= ABC; // quadrants b, d
+            int down = r >= AB;                         // quadrants c, d
+            u = (u << 1) | down;
+            v = (v << 1) | right;
+        }
+        e = { u, v };
+    }
+
+    // Random relabelling of the vertices
+    std::vector<int> perm(1u << scale);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), rng);
+    for (auto& e : edges) e = { perm[e.first], perm[e.second] };
+
+    return edges;
+}
+
+/*
+ * uniformEdges
+ * ------------
+ * Parameters:
+ *   n    : number of vertices
+ *   m    : number of edges to generate
+ *   seed : random seed
+ *
+ * Returns:
+ *   m (u, v) pairs with both endpoints uniform in [0, n)
+ */
+inline std::vector<std::pair<int,int>> uniformEdges(int n, long long m, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::pair<int,int>> edges((size_t)m);
+    for (auto& e : edges) e = { (int)(rng() % n), (int)(rng() % n) };
+    return edges;
+}
+
+/*
+ * gridEdges
+ * ---------
+ * Parameters:
+ *   width, height : grid size; vertex (x, y) is y * width + x
+ *
+ * Returns:
+ *   about 2 * width * height (u, v) pairs, one per grid edge
+ *   (store them undirected)
+ */
+inline std::vector<std::pair<int,int>> gridEdges(int width, int height) {
+    std::vector<std::pair<int,int>> edges;
+    edges.reserve(2 * (size_t)width * height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int u = y * width + x;
+            if (x + 1 < width) edges.push_back({ u, u + 1 });
+            if (y + 1 < height) edges.push_back({ u, u + width });
+        }
+    }
+    return edges;
+}
+
+#endif // SECTION11_GRAPH_GENERATORS_HPP
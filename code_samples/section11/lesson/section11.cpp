@@ -1,8 +1,16 @@
 #include <iostream>   // std::cout, std::endl for printing test output to the console
 #include <vector>     // std::vector dynamic arrays used for adjacency lists and various work buffers
 #include <queue>      // std::queue used for BFS and Kahn's algorithm in topo sort
-#include <limits>     // numeric limits (note: this file uses INT_MAX from <climits>; many compilers still make it visible indirectly)
+#include <limits>     // numeric limits
+#include <climits>    // INT_MAX for the BFS "infinite" distance sentinel
 #include <numeric>    // std::iota used to initialize DSU parent array
+#include <algorithm>  // std::min / std::max for splitting work between threads
+#include <atomic>     // std::atomic visited bitmap and work counter for parallel BFS
+#include <cstdint>    // uint64_t bitmap words
+#include <thread>     // std::thread workers for parallel BFS (build with -pthread)
+
+#include "../common/csr_graph.hpp"         // CsrGraph: flat offsets + neighbors arrays
+#include "../common/graph_generators.hpp"  // uniformEdges / rmatEdges for the larger tests
 
 using std::vector;    // bring just vector into the global namespace (in addition to the next line)
 using namespace std;  // bring in the rest of std:: (generally discouraged in headers, but acceptable in small examples)
@@ -38,6 +46,30 @@ vector<vector<int>> build_graph(int n, const vector<pair<int,int>>& edges) {
     return graph;
 }
 
+/*
+ * build_graph_csr
+ * ---------------
+ * Same graph as build_graph (UNDIRECTED, UNWEIGHTED), stored in CSR form:
+ * one offsets array plus one contiguous neighbors array instead of one
+ * vector per node.
+ *
+ * Parameters:
+ *   n     : number of nodes (assumed labeled 0..n-1)
+ *   edges : list of (u, v) pairs, 0-based indices
+ *
+ * Returns:
+ *   graph : CsrGraph; graph[u] lists the neighbors of u in the same order
+ *           as build_graph would store them
+ *
+ * Notes:
+ *   - Built with a counting pass (degrees, prefix sum, scatter): two
+ *     allocations in total, no per-node vectors growing by push_back.
+ *   - See ../common/csr_graph.hpp for the layout.
+ */
+CsrGraph build_graph_csr(int n, const vector<pair<int,int>>& edges) {
+    return buildCsr(n, edges, true);  // true = store u -> v and v -> u
+}
+
 /*
  * bfs_shortest
  * ------------
@@ -78,6 +110,150 @@ void bfs_shortest(int n, const vector<vector<int>>& graph, int src, vector<int>&
     }
 }
 
+/*
+ * bfs_shortest (CSR)
+ * ------------------
+ * Same as bfs_shortest above, for a graph built by build_graph_csr.
+ * graph[u] is a range over one slice of the contiguous neighbors array,
+ * so the loop body is unchanged.
+ */
+void bfs_shortest(int n, const CsrGraph& graph, int src, vector<int>& dist) {
+    const int INF = INT_MAX / 4;     // same sentinel as the adjacency-list version
+    dist.assign(n, INF);
+    queue<int> q;
+
+    dist[src] = 0;
+    q.push(src);
+
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        for (int v : graph[u]) {     // neighbors of u: one contiguous block
+            if (dist[v] == INF) {
+                dist[v] = dist[u] + 1;
+                q.push(v);
+            }
+        }
+    }
+}
+
+/*
+ * run_workers (helper)
+ * --------------------
+ * Runs work(0) .. work(workers - 1) in parallel: workers - 1 new threads,
+ * plus the calling thread, then waits for all of them.
+ */
+template <class Work>
+void run_workers(int workers, Work work) {
+    vector<thread> pool;
+    for (int t = 1; t < workers; t++) {
+        pool.emplace_back(work, t);
+    }
+    work(0);                         // the calling thread takes part too
+    for (auto& th : pool) th.join();
+}
+
+/*
+ * bfs_shortest_parallel
+ * ---------------------
+ * Multi-threaded, level-synchronous version of bfs_shortest for a CSR graph.
+ * Same distances, same INF sentinel.
+ *
+ * Parameters:
+ *   n       : number of nodes
+ *   graph   : CSR graph (build_graph_csr, or buildCsr for directed edges)
+ *   src     : source node index
+ *   dist    : output distances; overwritten by this function
+ *   threads : number of threads to use (<= 0 means one per hardware thread)
+ *
+ * How it works (one round per BFS level):
+ *   1) Expand: the frontier is cut into chunks of CHUNK nodes; threads take
+ *      chunks one at a time from a shared atomic counter (so a thread
+ *      that gets high-degree nodes does not hold the others up).
+ *   2) Claim: a neighbor v joins the next level only if this thread flips
+ *      its bit in the visited bitmap from 0 to 1 with compare-and-swap.
+ *      Exactly one thread wins for each v, so v is added once and dist[v]
+ *      has a single writer.
+ *   3) Collect: each thread appends its new nodes to its OWN buffer (no
+ *      locking, no shared push_back). A prefix sum over the buffer sizes
+ *      gives every thread its offset in the next frontier, and all threads
+ *      copy their buffers into place in parallel.
+ *
+ * Notes:
+ *   - The visited bitmap is 1 bit per node (n / 8 bytes), so the CAS
+ *     traffic touches far less memory than dist[] would.
+ *   - Nodes within a level can come out in a different order than with
+ *     bfs_shortest, but every node still gets the same (shortest) distance.
+ *   - Levels with few nodes use fewer threads: there is no point starting
+ *     threads for a frontier of 3 nodes.
+ */
+void bfs_shortest_parallel(int n, const CsrGraph& graph, int src, vector<int>& dist, int threads) {
+    const int INF = INT_MAX / 4;     // same sentinel as bfs_shortest
+    const size_t CHUNK = 1024;       // frontier nodes handed out at a time
+
+    if (threads <= 0) threads = (int)max(1u, thread::hardware_concurrency());
+    dist.assign(n, INF);
+
+    // Visited bitmap: bit v of word v/64; claimed with CAS.
+    vector<atomic<uint64_t>> visited(((size_t)n + 63) / 64);
+    for (auto& word : visited) word.store(0, memory_order_relaxed);
+
+    // Returns true if this call is the one that marked v visited.
+    auto claim = [&](int v) {
+        atomic<uint64_t>& word = visited[v >> 6];
+        uint64_t bit = 1ULL << (v & 63);
+        uint64_t old = word.load(memory_order_relaxed);
+        while (!(old & bit)) {       // cheap read first: most neighbors are already visited
+            if (word.compare_exchange_weak(old, old | bit, memory_order_relaxed)) {
+                return true;         // we flipped 0 -> 1
+            }
+            // CAS failed: old now holds the current word; re-check the bit
+        }
+        return false;
+    };
+
+    vector<int> frontier = { src }, next;
+    vector<vector<int>> local(threads);   // thread-local next-level buffers
+    vector<size_t> offset(threads + 1);
+    claim(src);
+    dist[src] = 0;
+
+    for (int level = 0; !frontier.empty(); level++) {
+        size_t chunks = (frontier.size() + CHUNK - 1) / CHUNK;
+        int workers = (int)min<size_t>((size_t)threads, chunks);
+        atomic<size_t> nextChunk(0);
+
+        // 1) + 2) Expand the frontier in chunks, claiming new nodes.
+        run_workers(workers, [&](int t) {
+            vector<int>& out = local[t];
+            out.clear();
+            for (size_t c = nextChunk.fetch_add(1); c < chunks; c = nextChunk.fetch_add(1)) {
+                size_t end = min(frontier.size(), (c + 1) * CHUNK);
+                for (size_t i = c * CHUNK; i < end; i++) {
+                    for (int v : graph[frontier[i]]) {
+                        if (claim(v)) {
+                            dist[v] = level + 1;   // v's only writer
+                            out.push_back(v);
+                        }
+                    }
+                }
+            }
+        });
+
+        // 3) Prefix sum of buffer sizes, then parallel copy into the next frontier.
+        offset[0] = 0;
+        for (int t = 0; t < workers; t++) {
+            offset[t + 1] = offset[t] + local[t].size();
+        }
+        next.resize(offset[workers]);
+        run_workers(workers, [&](int t) {
+            copy(local[t].begin(), local[t].end(), next.begin() + offset[t]);
+        });
+
+        frontier.swap(next);
+    }
+}
+
 /*
  * dfs_visit
  * ---------
@@ -134,6 +310,40 @@ int count_components(int n, const vector<vector<int>>& graph) {
     return components;
 }
 
+/*
+ * count_components (CSR)
+ * ----------------------
+ * Same as count_components above, for a graph built by build_graph_csr.
+ *
+ * Notes:
+ *   - Uses an explicit stack instead of recursion: CSR is meant for large
+ *     graphs, where a recursive DFS can overflow the call stack.
+ *   - Visits nodes in a different order than dfs_visit, but marks the same
+ *     components, so the count is identical.
+ */
+int count_components(int n, const CsrGraph& graph) {
+    vector<int> visited(n, 0);       // visited flags for each node
+    vector<int> stack;               // explicit DFS stack
+    int components = 0;
+    for (int s = 0; s < n; s++) {
+        if (visited[s]) continue;    // already part of a counted component
+        components++;
+        visited[s] = 1;
+        stack.push_back(s);
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            for (int v : graph[u]) {
+                if (!visited[v]) {   // mark when pushed, so each node is pushed once
+                    visited[v] = 1;
+                    stack.push_back(v);
+                }
+            }
+        }
+    }
+    return components;
+}
+
 /*
  * topo_sort
  * ---------
@@ -188,6 +398,43 @@ int topo_sort(int n, const vector<vector<int>>& graph, vector<int>& out_order) {
     return (int)out_order.size();    // if < n, there was a cycle preventing full ordering
 }
 
+/*
+ * topo_sort (CSR)
+ * ---------------
+ * Same as topo_sort above, for a DIRECTED graph in CSR form
+ * (e.g. buildCsr(n, edges, false)). Produces the same order, because CSR
+ * keeps every node's edges in input order.
+ */
+int topo_sort(int n, const CsrGraph& graph, vector<int>& out_order) {
+    vector<int> indeg(n, 0);
+
+    // Indegrees: one sequential pass over the whole neighbors array.
+    for (int v : graph.targets) {
+        indeg[v]++;
+    }
+
+    queue<int> q;
+    for (int i = 0; i < n; i++) {
+        if (indeg[i] == 0) {
+            q.push(i);
+        }
+    }
+
+    out_order.clear();
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        out_order.push_back(u);
+        for (int v : graph[u]) {
+            if (--indeg[v] == 0) {
+                q.push(v);
+            }
+        }
+    }
+
+    return (int)out_order.size();
+}
+
 /*
  * dijkstra_simple
  * ---------------
@@ -545,6 +792,81 @@ void test_dsu() {
     cout << "Number of disjoint sets = " << count << " (expected 2)\n\n";
 }
 
+/*
+ * test_csr_matches_adjacency
+ * --------------------------
+ * Runs bfs_shortest, count_components and topo_sort on the graphs from the
+ * tests above in both representations (vector<vector<int>> and CsrGraph)
+ * and checks the results are identical.
+ */
+void test_csr_matches_adjacency() {
+    cout << "=== Test 6: CSR graph gives the same results ===\n";
+    bool ok = true;
+
+    // Undirected graphs from Tests 1 and 2
+    vector<pair<int, vector<pair<int,int>>>> graphs = {
+        { 5, { {0,1}, {1,2}, {1,3}, {2,4} } },
+        { 6, { {0,1}, {1,2}, {3,4} } }
+    };
+    for (const auto& [n, edges] : graphs) {
+        auto g = build_graph(n, edges);
+        CsrGraph c = build_graph_csr(n, edges);
+
+        vector<int> distList, distCsr;
+        bfs_shortest(n, g, 0, distList);
+        bfs_shortest(n, c, 0, distCsr);
+        ok = ok && distList == distCsr;
+        ok = ok && count_components(n, g) == count_components(n, c);
+    }
+
+    // DAG from Test 3, directed
+    int n = 6;
+    vector<pair<int,int>> dagEdges = { {5,2}, {5,0}, {4,0}, {4,1}, {2,3}, {3,1} };
+    vector<vector<int>> dag(n);
+    for (auto [u, v] : dagEdges) dag[u].push_back(v);
+    CsrGraph dagCsr = buildCsr(n, dagEdges, false);
+
+    vector<int> orderList, orderCsr;
+    topo_sort(n, dag, orderList);
+    topo_sort(n, dagCsr, orderCsr);
+    ok = ok && orderList == orderCsr;
+
+    cout << "CSR offsets for Test 1 graph: ";
+    CsrGraph c = build_graph_csr(5, graphs[0].second);
+    for (long long off : c.offsets) cout << off << " ";
+    cout << "\nBFS, components and topo order match: " << (ok ? "yes" : "NO") << "\n\n";
+}
+
+/*
+ * test_parallel_bfs
+ * -----------------
+ * Runs bfs_shortest_parallel with 1, 2, 4 and 8 threads on a uniform random
+ * graph and an R-MAT graph, and checks every result against bfs_shortest.
+ */
+void test_parallel_bfs() {
+    cout << "=== Test 7: Parallel BFS matches bfs_shortest ===\n";
+    int n = 1 << 16;
+    vector<pair<string, vector<pair<int,int>>>> inputs = {
+        { "uniform", uniformEdges(n, 1 << 19, 3) },
+        { "R-MAT",   rmatEdges(16, 1 << 19, 4) }
+    };
+
+    for (const auto& [name, edges] : inputs) {
+        CsrGraph g = build_graph_csr(n, edges);
+        vector<int> expected, got;
+        bfs_shortest(n, g, edges[0].first, expected);
+
+        cout << name << " graph (" << n << " nodes, " << edges.size() << " edges):";
+        for (int threads : { 1, 2, 4, 8 }) {
+            bfs_shortest_parallel(n, g, edges[0].first, got, threads);
+            cout << " " << threads << " thread" << (threads > 1 ? "s " : " ")
+                 << (got == expected ? "ok" : "WRONG") << (threads < 8 ? "," : "");
+        }
+        cout << "\n";
+    }
+    cout << "\n";
+}
+
 // ===========================
 // main
 // ===========================
@@ -555,11 +877,15 @@ void test_dsu() {
  * Runs all tests in sequence. This file is structured as a self-contained demo:
  * graph utilities + DSU + small, readable tests that print expected results.
  */
+#ifndef SECTION11_NO_MAIN  // benchmark/graph_benchmark.cpp includes this file without main()
 int main() {
     test_bfs_and_components();
     test_components_disconnected();
     test_topo_sort();
     test_dijkstra_simple();
     test_dsu();
+    test_csr_matches_adjacency();
+    test_parallel_bfs();
     return 0;                           // conventional successful exit code
 }
+#endif // SECTION11_NO_MAIN
@@ -1,5 +1,7 @@
 #include <iostream>  // std::cout for printing test output
 #include <vector>    // std::vector for adjacency lists and component labels
+
+#include "../../common/csr_graph.hpp"  // CsrGraph: flat offsets + neighbors arrays
 using namespace std; // bring standard library names into the global namespace (fine for small demos)
 
 // =================================
@@ -63,6 +65,44 @@ int connectedComponents(int n, const vector<vector<int>>& adj, vector<int>& comp
     return cid;
 }
 
+// =================================
+// Same, for a CSR graph
+// =================================
+int connectedComponents(int n, const CsrGraph& g, vector<int>& comp) {
+    // Same as above, for a graph stored as a CsrGraph (see csr_graph.hpp).
+    //
+    // Differences:
+    //   - Neighbors come from one contiguous array (g[u] is a slice of it).
+    //   - DFS uses an explicit stack instead of recursion, so graphs with
+    //     millions of nodes cannot overflow the call stack.
+    //
+    // Component ids are identical: a new id is still handed out to the
+    // smallest unlabeled node, in increasing node order.
+    comp.assign(n, -1);
+    vector<int> stack;
+    int cid = 0;
+
+    for (int s = 0; s < n; s++) {
+        if (comp[s] != -1) continue;
+
+        // Label s's whole component with cid.
+        comp[s] = cid;
+        stack.push_back(s);
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            for (int v : g[u]) {
+                if (comp[v] == -1) {   // label when pushed: each node pushed once
+                    comp[v] = cid;
+                    stack.push_back(v);
+                }
+            }
+        }
+        cid++;
+    }
+    return cid;
+}
+
 // =================================
 // Helper functions for tests
 // =================================
@@ -117,12 +157,18 @@ void runTest(const string& name, int n, const vector<vector<int>>& adj) {
     cout << "Component count: " << count << "\n";
     cout << "Component IDs   : ";
     printComp(comp);
+
+    // Same computation on the CSR form of the graph.
+    vector<int> compCsr;
+    int countCsr = connectedComponents(n, csrFromAdjacency(adj), compCsr);
+    cout << "\nCSR same        : " << (countCsr == count && compCsr == comp ? "yes" : "NO");
     cout << "\n\n";
 }
 
 // =================================
 // Main test driver
 // =================================
+#ifndef SECTION11_NO_MAIN  // benchmark/graph_benchmark.cpp includes this file without main()
 int main() {
     // ------------------------------
     // Test 1: Fully connected graph
@@ -214,3 +260,4 @@ int main() {
 
     return 0; // successful termination
 }
+#endif // SECTION11_NO_MAIN
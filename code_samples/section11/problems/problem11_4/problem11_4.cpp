@@ -2,6 +2,22 @@
 #include <vector>    // std::vector for adjacency lists and distance array
 #include <queue>     // std::priority_queue for Dijkstra's min-priority queue
 #include <limits>    // std::numeric_limits for an "infinity" sentinel
+#include <algorithm> // std::max / std::min for bucket bookkeeping
+#include <cstdint>   // uint32_t keys of the radix heap
+#include <utility>   // std::pair entries of the radix heap
+#include <random>    // random weights for the larger test
+
+#include "../../common/csr_graph.hpp"         // CsrGraph: flat offsets + targets + weights
+#include "../../common/graph_generators.hpp"  // uniformEdges / gridEdges for the larger test
+
+// IndexedMinHeap4 from the section 6 lesson (its main() is left out)
+#ifdef SECTION6_NO_MAIN
+    #include "../../../section6/lesson/section6.cpp"
+#else
+    #define SECTION6_NO_MAIN
+    #include "../../../section6/lesson/section6.cpp"
+    #undef SECTION6_NO_MAIN
+#endif
 using namespace std; // convenience for small sample code
 
 /*
@@ -73,10 +89,315 @@ vector<int> dijkstra(int n, const vector<vector<Edge>>& adj, int s) {
     return dist;
 }
 
+vector<int> dijkstra(int n, const CsrGraph& g, int s) {
+    /*
+     * Same as above, for a weighted graph stored as a CsrGraph
+     * (see csr_graph.hpp, buildCsrWeighted).
+     *
+     * The outgoing edges of u are the index range
+     *   [g.offsets[u], g.offsets[u + 1])
+     * of two parallel contiguous arrays, g.targets and g.weights, instead of
+     * a separate vector<Edge> per node.
+     */
+    const int INF = numeric_limits<int>::max() / 2;
+    vector<int> dist(n, INF);
+    dist[s] = 0;
+
+    using P = pair<int,int>; // (dist, node)
+    priority_queue<P, vector<P>, greater<P>> pq;
+    pq.push({0, s});
+
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+
+        if (d > dist[u]) continue; // stale entry
+
+        for (long long i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            int v = g.targets[i];
+            int nd = d + g.weights[i];
+
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                pq.push({nd, v});
+            }
+        }
+    }
+
+    return dist;
+}
+
+// ==========================
+// Monotone priority queues for small integer weights
+// ==========================
+//
+// Dijkstra only ever pops distances in NON-DECREASING order, and with
+// integer weights <= C every distance still in the queue lies in
+// [d, d + C], where d is the last distance popped. A general-purpose heap
+// ignores both facts and pays O(log n) per operation. The two queues below
+// use them:
+//
+//   DialBuckets : C + 1 buckets used as a ring, one per distance value.
+//                 O(1) insert / decrease-key, pop scans at most C + 1
+//                 buckets. Best for small C (e.g. travel times 1..100).
+//   RadixHeap   : 33 buckets by the highest bit in which a key differs
+//                 from the last popped key. A key only ever moves to a
+//                 LOWER bucket, so each entry moves at most 32 times:
+//                 O(log C) amortized, whatever the weights.
+//
+// A third option keeps a comparison heap but fixes the duplicates:
+//
+//   IndexedHeap : IndexedMinHeap4 from section 6 - a 4-ary heap with
+//                 position tracking and real decreaseKey(). At most one
+//                 entry per vertex (O(V) instead of O(E) entries), any
+//                 weights.
+
+enum class DijkstraQueue {
+    BinaryHeap,   // std::priority_queue with lazy deletion (dijkstra above)
+    Dial,         // bucket queue with true decrease-key
+    RadixHeap,    // radix heap with lazy deletion
+    IndexedHeap   // indexed 4-ary heap with decrease-key (section 6)
+};
+
+/*
+ * DialBuckets
+ * -----------
+ * Bucket queue over vertices 0..n-1. Every queued vertex sits in exactly
+ * one bucket, linked through next/prev arrays (no allocation per push), so
+ * decrease-key just moves it to another bucket: the queue never holds more
+ * than n entries and never yields stale ones.
+ */
+struct DialBuckets {
+    int ring;                  // number of buckets = max weight + 1
+    vector<int> head;          // head[b] = first vertex in bucket b, or -1
+    vector<int> next, prev;    // doubly linked lists through the vertices
+    vector<int> bucketOf;      // bucket of a queued vertex, -1 if not queued
+    long long size = 0;
+    int cursor = 0;            // distance of the bucket scanned last
+
+    DialBuckets(int n, int maxWeight)
+        : ring(maxWeight + 1), head(ring, -1), next(n, -1), prev(n, -1), bucketOf(n, -1) {}
+
+    bool empty() const { return size == 0; }
+
+    // Inserts v with distance d, or moves it there if already queued.
+    void pushOrDecrease(int v, int d) {
+        if (bucketOf[v] != -1) unlink(v);
+        int b = d % ring;
+        bucketOf[v] = b;
+        prev[v] = -1;
+        next[v] = head[b];
+        if (head[b] != -1) prev[head[b]] = v;
+        head[b] = v;
+        size++;
+    }
+
+    // Removes and returns a vertex with the smallest distance; d receives it.
+    int pop(int& d) {
+        while (head[cursor % ring] == -1) cursor++;  // at most `ring` empty buckets
+        int v = head[cursor % ring];
+        unlink(v);
+        d = cursor;
+        return v;
+    }
+
+private:
+    void unlink(int v) {
+        int b = bucketOf[v];
+        if (prev[v] != -1) next[prev[v]] = next[v];
+        else head[b] = next[v];
+        if (next[v] != -1) prev[next[v]] = prev[v];
+        bucketOf[v] = -1;
+        size--;
+    }
+};
+
+// Index of the highest set bit of x (x != 0)
+inline int highestBit(uint32_t x) {
+#if defined(__GNUC__)
+    return 31 - __builtin_clz(x);
+#else
+    int bit = 0;
+    while (x >>= 1) bit++;
+    return bit;
+#endif
+}
+
+/*
+ * RadixHeap
+ * ---------
+ * Monotone min-queue of (key, vertex) entries with unsigned 32-bit keys.
+ * Keys pushed must be >= the last key popped (true for Dijkstra).
+ *
+ * Bucket 0 holds keys equal to `last`; bucket i (1..32) holds keys whose
+ * highest bit differing from `last` is bit i - 1. When bucket 0 runs dry,
+ * the first non-empty bucket is emptied: its minimum becomes the new
+ * `last` and every entry drops into a lower bucket.
+ */
+struct RadixHeap {
+    using Entry = pair<uint32_t,int>;   // (key, vertex)
+
+    vector<Entry> buckets[33];
+    uint32_t last = 0;
+    long long size = 0;
+
+    static int bucketIndex(uint32_t key, uint32_t last) {
+        return key == last ? 0 : 1 + highestBit(key ^ last);
+    }
+
+    bool empty() const { return size == 0; }
+
+    void push(uint32_t key, int v) {
+        buckets[bucketIndex(key, last)].push_back({key, v});
+        size++;
+    }
+
+    Entry pop() {
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) i++;
+
+            // New last = smallest key in bucket i; redistribute the bucket.
+            uint32_t newLast = buckets[i][0].first;
+            for (const auto& e : buckets[i]) newLast = min(newLast, e.first);
+            last = newLast;
+            for (const auto& e : buckets[i]) {
+                buckets[bucketIndex(e.first, last)].push_back(e);
+            }
+            buckets[i].clear();
+        }
+        Entry e = buckets[0].back();
+        buckets[0].pop_back();
+        size--;
+        return e;
+    }
+};
+
+vector<int> dijkstraDial(int n, const CsrGraph& g, int s) {
+    /*
+     * Dijkstra with a Dial bucket queue (see DialBuckets).
+     * Weights must be small non-negative ints: memory is O(n + maxWeight).
+     */
+    const int INF = numeric_limits<int>::max() / 2;
+    vector<int> dist(n, INF);
+
+    int maxWeight = 0;
+    for (int w : g.weights) maxWeight = max(maxWeight, w);
+
+    DialBuckets queue(n, maxWeight);
+    dist[s] = 0;
+    queue.pushOrDecrease(s, 0);
+
+    while (!queue.empty()) {
+        int d;
+        int u = queue.pop(d);   // d == dist[u]: no stale entries to skip
+
+        for (long long i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            int v = g.targets[i];
+            int nd = d + g.weights[i];
+            // No "settled" check needed: dist[v] <= d for a settled v
+            // (weights >= 0), so nd < dist[v] already rules it out.
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                queue.pushOrDecrease(v, nd);   // true decrease-key
+            }
+        }
+    }
+
+    return dist;
+}
+
+vector<int> dijkstraRadix(int n, const CsrGraph& g, int s) {
+    /*
+     * Dijkstra with a radix heap (see RadixHeap). Like the binary-heap
+     * version it pushes a new entry on every improvement and skips stale
+     * ones, but push is O(1) and pop is O(log C) amortized.
+     */
+    const int INF = numeric_limits<int>::max() / 2;
+    vector<int> dist(n, INF);
+
+    RadixHeap heap;
+    dist[s] = 0;
+    heap.push(0, s);
+
+    while (!heap.empty()) {
+        auto [key, u] = heap.pop();
+        int d = (int)key;
+        if (d > dist[u]) continue;   // stale entry
+
+        for (long long i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            int v = g.targets[i];
+            int nd = d + g.weights[i];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                heap.push((uint32_t)nd, v);
+            }
+        }
+    }
+
+    return dist;
+}
+
+vector<int> dijkstraIndexedHeap(int n, const CsrGraph& g, int s) {
+    /*
+     * Dijkstra with IndexedMinHeap4: each vertex is in the heap at most
+     * once, and an improvement lowers its key in place instead of pushing
+     * a second copy. Nothing stale is ever popped.
+     */
+    const int INF = numeric_limits<int>::max() / 2;
+    vector<int> dist(n, INF);
+
+    IndexedMinHeap4 heap(n);
+    dist[s] = 0;
+    heap.insert(s, 0);
+
+    while (!heap.empty()) {
+        int u = heap.extractMin();
+        int d = dist[u];
+
+        for (long long i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            int v = g.targets[i];
+            int nd = d + g.weights[i];
+            if (nd < dist[v]) {   // never true for a settled v (see dijkstraDial)
+                dist[v] = nd;
+                if (heap.contains(v)) heap.decreaseKey(v, nd);
+                else                  heap.insert(v, nd);
+            }
+        }
+    }
+
+    return dist;
+}
+
+vector<int> dijkstra(int n, const CsrGraph& g, int s, DijkstraQueue queue) {
+    /*
+     * Dijkstra on a CSR graph with a selectable priority queue.
+     * All strategies return the same distances.
+     */
+    switch (queue) {
+        case DijkstraQueue::Dial:        return dijkstraDial(n, g, s);
+        case DijkstraQueue::RadixHeap:   return dijkstraRadix(n, g, s);
+        case DijkstraQueue::IndexedHeap: return dijkstraIndexedHeap(n, g, s);
+        default:                         return dijkstra(n, g, s);
+    }
+}
+
 // ==========================
 // Helpers
 // ==========================
 
+CsrGraph toCsr(const vector<vector<Edge>>& adj) {
+    /*
+     * Converts an adjacency list of Edge to a weighted CsrGraph,
+     * keeping every node's edges in the same order.
+     */
+    vector<WeightedEdge> edges;
+    for (int u = 0; u < (int)adj.size(); u++) {
+        for (const auto& e : adj[u]) edges.push_back({u, e.to, e.w});
+    }
+    return buildCsrWeighted((int)adj.size(), edges, false);
+}
+
 void addEdge(vector<vector<Edge>>& adj, int u, int v, int w) {
     /*
      * Adds a DIRECTED edge u -> v with weight w to the graph.
@@ -137,6 +458,11 @@ void runTest(const string& name, int n, const vector<vector<Edge>>& adj, int src
     auto dist = dijkstra(n, adj, src);
     cout << "Distances: ";
     printDist(dist);
+    CsrGraph g = toCsr(adj);
+    cout << "CSR same : " << (dijkstra(n, g, src) == dist ? "yes" : "NO") << "\n";
+    cout << "Dial     : " << (dijkstra(n, g, src, DijkstraQueue::Dial) == dist ? "yes" : "NO") << "\n";
+    cout << "Radix    : " << (dijkstra(n, g, src, DijkstraQueue::RadixHeap) == dist ? "yes" : "NO") << "\n";
+    cout << "Indexed  : " << (dijkstra(n, g, src, DijkstraQueue::IndexedHeap) == dist ? "yes" : "NO") << "\n";
     cout << "\n";
 }
 
@@ -144,6 +470,7 @@ void runTest(const string& name, int n, const vector<vector<Edge>>& adj, int src
 // Main Test Harness
 // ==========================
 
+#ifndef SECTION11_NO_MAIN  // benchmark/graph_benchmark.cpp includes this file without main()
 int main() {
 
     // -----------------------------------------
@@ -225,5 +552,36 @@ int main() {
         runTest("Disconnected graph", n, adj, 0);
     }
 
+    // -----------------------------------------
+    // Test 4: Queue strategies on larger graphs
+    // -----------------------------------------
+    {
+        cout << "=== Test 4: Binary heap vs Dial vs radix heap vs indexed 4-ary heap ===\n";
+
+        // Random weights 0..100 (zero-weight edges included on purpose).
+        mt19937 rng(5);
+        auto weigh = [&](const vector<pair<int,int>>& pairs) {
+            vector<WeightedEdge> edges;
+            for (auto [u, v] : pairs) edges.push_back({u, v, (int)(rng() % 101)});
+            return edges;
+        };
+
+        // Road-like grid (undirected) and random directed graph, 10^4 nodes each.
+        CsrGraph grid = buildCsrWeighted(10000, weigh(gridEdges(100, 100)), true);
+        CsrGraph random = buildCsrWeighted(10000, weigh(uniformEdges(10000, 80000, 6)), false);
+
+        for (const CsrGraph* g : { &grid, &random }) {
+            auto heap = dijkstra(g->n, *g, 0);
+            bool same = dijkstra(g->n, *g, 0, DijkstraQueue::Dial) == heap &&
+                        dijkstra(g->n, *g, 0, DijkstraQueue::RadixHeap) == heap &&
+                        dijkstra(g->n, *g, 0, DijkstraQueue::IndexedHeap) == heap;
+            cout << (g == &grid ? "100x100 grid" : "random graph") << ", "
+                 << g->edgeCount() << " edges: all strategies agree: "
+                 << (same ? "yes" : "NO") << "\n";
+        }
+        cout << "\n";
+    }
+
     return 0; // successful termination
 }
+#endif // SECTION11_NO_MAIN
@@ -0,0 +1,783 @@
+/*
+    benchmark.cpp
+    -------------
+    One benchmark driver for every section12 sort and search example.
+
+    WHY
+    ---
+    Each example has its own main(), reads unordered.txt / ordered.txt from
+    its own relative path and prints comparison/write counts for one 10k
+    input. That says nothing about how the algorithms behave on other input
+    SHAPES or at larger SIZES, or what the hardware is doing.
+
+    This driver compiles the examples themselves into one program (each file
+    is #included inside its own namespace with SECTION12_NO_MAIN defined, so
+    their main() functions drop out) and runs them over generated data.
+
+    Not registered: external sort (example 13) and indirect sort (example
+    16). Everything here sorts a vector<int> in memory; external sort is
+    about file I/O under a memory budget and indirect sort about records
+    with large payloads, and each measures that in its own main().
+
+    DISTRIBUTIONS
+    -------------
+        random      uniform ints in [0, 2^30)
+        sorted      random values, ascending
+        reversed    random values, descending
+        few-unique  uniform ints in [0, 16)
+        organ-pipe  0, 1, ..., n/2, ..., 1, 0
+        zipf        Zipf(s = 1) ranks over min(n, 2^20) distinct values
+
+    SIZES
+    -----
+    Powers of ten from --min-n to --max-n (default 10^3 .. 10^6; up to 10^8
+    with --max-n 100000000 — needs ~1 GB of RAM and a lot of patience).
+
+    Some combinations are skipped because they are quadratic:
+        - selection / bubble / insertion sort above QUADRATIC_MAX_N
+        - quick sort (last-element pivot) on anything except "random"
+          above LAST_PIVOT_MAX_N (sorted input also recurses n deep)
+        - linear search above LINEAR_MAX_N
+
+    MEASUREMENTS
+    ------------
+    Sorts: a fresh copy of the input is sorted repeatedly (copy not timed)
+    until MIN_SECONDS have passed or MAX_REPS runs are done; every result is
+    compared with a std::sort()ed copy of the input (so lost or duplicated
+    elements are caught, not just order).
+    Searches: the input is sorted once, then a batch of queries (half present
+    values, half random values that may be absent) is searched repeatedly;
+    every answer is checked. Searches over a layout of their own (Eytzinger,
+    S-tree, learned index, vEB) build it once per input, untimed; the batch
+    search answers the whole query batch in one call.
+
+    Reported per element (sorts) or per query (searches):
+        ns            wall-clock time
+        cycles        \
+        branch-miss    > Linux perf_event_open, user space only
+        cache-miss    /  ("n/a" if the kernel does not allow it, e.g. in
+                         containers or with perf_event_paranoid > 2)
+
+    USAGE
+    -----
+        benchmark [--min-n N] [--max-n N] [--dist random,zipf,...]
+                  [--only name] [--csv out.csv] [--json out.json] [--seed S]
+                  [--data file,file...]
+
+        --only keeps algorithms whose name contains the given text
+        (e.g. --only quick, --only search).
+
+        --data runs on the given files instead of generated inputs (sizes
+        and distributions are ignored). Binary datasets made with
+        tools/convert_dataset are mmap()ed (raw int32: no parsing at all,
+        one memcpy into the working copy); anything else is read as text.
+
+    BUILD (from this folder)
+    -----
+        g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+// Every header the examples use, included once at global scope, so the
+// #includes inside the example files below are no-ops in their namespaces.
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+    #include <direct.h>
+#else
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+#endif
+
+#include "../common/sorting_networks.hpp"
+#include "../common/generic_sort.hpp"
+#include "../common/fast_loader.hpp"
+#include "../common/binary_dataset.hpp"
+
+// ------------------------------------------------------------
+// The examples, one namespace each
+// ------------------------------------------------------------
+#define SECTION12_NO_MAIN
+
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+namespace ex1  {
+#include "../example_1_linear_search/linear_search.cpp"
+}
+namespace ex2  {
+#include "../example_2_binary_search/binary_search.cpp"
+}
+namespace ex3  {
+#include "../example_3_jump_search/jump_search.cpp"
+}
+namespace ex4  {
+#include "../example_4_interpolation_search/interpolation_search.cpp"
+}
+namespace ex5  {
+#include "../example_5_exponential_search/exponential_search.cpp"
+}
+namespace ex6  {
+#include "../example_6_selection_sort/selection_sort.cpp"
+}
+namespace ex7  {
+#include "../example_7_bubble_sort/bubble_sort.cpp"
+}
+namespace ex8  {
+#include "../example_8_merge_sort/merge_sort.cpp"
+}
+namespace ex9  {
+#include "../example_9_insertion_sort/insertion_sort.cpp"
+}
+namespace ex10 {
+#include "../example_10_quick_sort/quick_sort.cpp"
+}
+namespace ex11 {
+#include "../example_11_heap_sort/heap_sort.cpp"
+}
+namespace ex12 {
+#include "../example_12_tim_sort/tim_sort.cpp"
+}
+namespace ex14 {
+#include "../example_14_range_sort/range_sort.cpp"
+}
+namespace ex17 {
+#include "../example_17_eytzinger_search/eytzinger_search.cpp"
+}
+namespace ex18 {
+#include "../example_18_batch_search/batch_search.cpp"
+}
+namespace ex19 {
+#include "../example_19_s_tree_search/s_tree_search.cpp"
+}
+namespace ex20 {
+#include "../example_20_learned_index/learned_index.cpp"
+}
+namespace ex21 {
+#include "../example_21_veb_search/veb_search.cpp"
+}
+
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+using namespace std;
+
+// ------------------------------------------------------------
+// Limits
+// ------------------------------------------------------------
+static const size_t QUADRATIC_MAX_N  = 10000;   // selection / bubble / insertion
+static const size_t LAST_PIVOT_MAX_N = 10000;   // Lomuto quick sort on non-random input
+static const size_t LINEAR_MAX_N     = 1000000; // linear search
+static const double MIN_SECONDS      = 0.2;     // keep repeating until this much time
+static const int    MAX_REPS         = 50;
+static const size_t SEARCH_QUERIES   = 100000;
+static const size_t SLOW_QUERIES     = 1000;    // linear search
+
+// ------------------------------------------------------------
+// Algorithm registry
+// ------------------------------------------------------------
+enum class Limit { None, Quadratic, LastPivot, Linear };
+
+struct SortAlgo {
+    const char* name;
+    void (*run)(vector<int>&);
+    Limit limit;
+};
+
+struct SearchAlgo {
+    const char* name;
+    int (*run)(const vector<int>&, int);
+    Limit limit;
+    void (*prepare)(const vector<int>&) = nullptr;  // builds a search layout, untimed
+    void (*runBatch)(const vector<int>&, const vector<int>&, vector<int>&) = nullptr;  // all queries at once
+};
+
+// Layouts built by SearchAlgo::prepare for the current sorted input
+static ex17::Eytzinger    g_eytzinger;
+static ex19::STree        g_stree;
+static ex20::LearnedIndex g_learned;   // points into the sorted input itself
+static ex21::VebTree      g_veb;
+
+static const SortAlgo SORTS[] = {
+    { "selection_sort",    [](vector<int>& a) { ex6::SortStats s; ex6::selectionSort(a, s); }, Limit::Quadratic },
+    { "bubble_sort",       [](vector<int>& a) { long long c, s; ex7::bubbleSort(a, c, s); }, Limit::Quadratic },
+    { "insertion_sort",    [](vector<int>& a) { long long c = 0, w = 0; ex9::insertionSort(a, c, w); }, Limit::Quadratic },
+    { "merge_sort",        [](vector<int>& a) { ex8::Stats s; ex8::mergeSort(a, s); }, Limit::None },
+    { "merge_sort_net",    [](vector<int>& a) { ex8::Stats s; ex8::mergeSort(a, s, true); }, Limit::None },
+    { "quick_sort",        [](vector<int>& a) { ex10::quickSort(a); }, Limit::LastPivot },
+    { "quick_sort_net",    [](vector<int>& a) { ex10::quickSort(a, true); }, Limit::LastPivot },
+    { "quick_sort_avx2",   [](vector<int>& a) { ex10::quickSort(a, false, ex10::PartitionStrategy::AVX2); }, Limit::LastPivot },
+    { "quick_sort_avx512", [](vector<int>& a) { ex10::quickSort(a, false, ex10::PartitionStrategy::AVX512); }, Limit::LastPivot },
+    { "heap_sort",         [](vector<int>& a) { ex11::heapSort(a); }, Limit::None },
+    { "heap_sort_floyd",   [](vector<int>& a) { ex11::heapSortFloyd(a); }, Limit::None },
+    { "heap_sort_4ary",    [](vector<int>& a) { ex11::heapSort4ary(a); }, Limit::None },
+    { "tim_sort",          [](vector<int>& a) { ex12::Stats s; ex12::timSort(a, s); }, Limit::None },
+    { "range_sort",        [](vector<int>& a) { ex14::Stats s; ex14::rangeSort(a, s); }, Limit::None },
+    { "gsort_quick",       [](vector<int>& a) { gsort::quickSort(a.begin(), a.end()); }, Limit::None },
+    { "gsort_heap",        [](vector<int>& a) { gsort::heapSort(a.begin(), a.end()); }, Limit::None },
+    { "gsort_merge",       [](vector<int>& a) { gsort::mergeSort(a.begin(), a.end()); }, Limit::None },
+    { "std_sort",          [](vector<int>& a) { std::sort(a.begin(), a.end()); }, Limit::None },
+};
+
+static const SearchAlgo SEARCHES[] = {
+    { "linear_search",        [](const vector<int>& a, int t) { long long s; return ex1::linearSearchSteps(a, t, s); }, Limit::Linear },
+    { "linear_search_simd",   [](const vector<int>& a, int t) { return ex1::linearSearch(a, t); }, Limit::Linear },
+    { "binary_search",        [](const vector<int>& a, int t) { return ex2::binarySearch(a, t); }, Limit::None },
+    { "jump_search",          [](const vector<int>& a, int t) { return ex3::jumpSearch(a, t); }, Limit::None },
+    { "interpolation_search", [](const vector<int>& a, int t) { return ex4::interpolationSearch(a, t); }, Limit::None },
+    { "interpolation_hybrid", [](const vector<int>& a, int t) { int s = 0; return ex4::interpolationSearchAdaptive(a, t, s); }, Limit::None },
+    { "exponential_search",   [](const vector<int>& a, int t) { int s = 0; return ex5::exponentialSearch(a, t, s); }, Limit::None },
+    { "eytzinger_search",     [](const vector<int>&, int t) { return ex17::eytzingerSearch(g_eytzinger, t); }, Limit::None,
+                              [](const vector<int>& a) { g_eytzinger = ex17::buildEytzinger(a); } },
+    { "batch_search",         nullptr, Limit::None, nullptr,
+                              [](const vector<int>& a, const vector<int>& q, vector<int>& out) { ex18::searchBatch(a, q, out); } },
+    { "s_tree_search",        [](const vector<int>&, int t) { return ex19::streeFind(g_stree, t); }, Limit::None,
+                              [](const vector<int>& a) { g_stree = ex19::buildSTree(a); } },
+    { "learned_index",        [](const vector<int>&, int t) { return ex20::learnedSearch(g_learned, t); }, Limit::None,
+                              [](const vector<int>& a) { g_learned = ex20::buildLearnedIndex(a); } },
+    { "veb_search",           [](const vector<int>&, int t) { return ex21::vebSearch(g_veb, t); }, Limit::None,
+                              [](const vector<int>& a) { g_veb = ex21::buildVeb(a); } },
+};
+
+// ------------------------------------------------------------
+// Distributions
+// ------------------------------------------------------------
+static const char* DISTRIBUTIONS[] = {
+    "random", "sorted", "reversed", "few-unique", "organ-pipe", "zipf"
+};
+
+static vector<int> generate(const string& dist, size_t n, uint64_t seed)
+{
+    mt19937_64 rng(seed);
+    vector<int> a(n);
+
+    if (dist == "few-unique") {
+        for (auto& x : a) x = (int)(rng() % 16);
+    } else if (dist == "organ-pipe") {
+        for (size_t i = 0; i < n; i++) a[i] = (int)(i < n / 2 ? i : n - i);
+    } else if (dist == "zipf") {
+        // Inverse CDF over K ranks: P(rank r) ~ 1 / r
+        size_t k = min<size_t>(n, 1 << 20);
+        vector<double> cdf(k);
+        double sum = 0.0;
+        for (size_t r = 0; r < k; r++) {
+            sum += 1.0 / (double)(r + 1);
+            cdf[r] = sum;
+        }
+        uniform_real_distribution<double> u(0.0, sum);
+        for (auto& x : a) x = (int)(lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin());
+    } else {
+        for (auto& x : a) x = (int)(rng() & ((1u << 30) - 1));
+        if (dist == "sorted")   sort(a.begin(), a.end());
+        if (dist == "reversed") sort(a.begin(), a.end(), greater<int>());
+    }
+    return a;
+}
+
+// ------------------------------------------------------------
+// Hardware counters (Linux perf_event_open)
+// ------------------------------------------------------------
+/*
+    PerfCounters
+    ------------
+    Three user-space hardware counters, enabled only around the timed code.
+    If any of them cannot be opened, available() is false and the results
+    are reported as "n/a".
+*/
+class PerfCounters {
+public:
+    enum { Cycles, BranchMisses, CacheMisses, Count };
+
+    PerfCounters() {
+#if defined(__linux__)
+        const uint64_t configs[Count] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES
+        };
+        ok_ = true;
+        for (int i = 0; i < Count; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fds_[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fds_[i] < 0) ok_ = false;
+        }
+#endif
+        reset();
+    }
+
+    ~PerfCounters() {
+#if defined(__linux__)
+        for (int i = 0; i < Count; i++) {
+            if (fds_[i] >= 0) close(fds_[i]);
+        }
+#endif
+    }
+
+    bool available() const { return ok_; }
+
+    void reset() {
+        for (int i = 0; i < Count; i++) totals_[i] = 0;
+    }
+
+    void start() {
+#if defined(__linux__)
+        if (!ok_) return;
+        for (int i = 0; i < Count; i++) {
+            ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop() {
+#if defined(__linux__)
+        if (!ok_) return;
+        for (int i = 0; i < Count; i++) {
+            ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+            long long value = 0;
+            if (read(fds_[i], &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+                totals_[i] += value;
+            }
+        }
+#endif
+    }
+
+    long long total(int which) const { return totals_[which]; }
+
+private:
+    int fds_[Count] = { -1, -1, -1 };
+    bool ok_ = false;
+    long long totals_[Count];
+};
+
+// ------------------------------------------------------------
+// Results
+// ------------------------------------------------------------
+struct Result {
+    string kind;         // "sort" or "search"
+    string algorithm;
+    string distribution;
+    size_t n = 0;
+    long long units = 0; // elements sorted or queries answered, summed over reps
+    int reps = 0;
+    double ns = 0.0;     // per unit
+    double cycles = -1.0, branchMisses = -1.0, cacheMisses = -1.0;  // per unit, -1 = n/a
+    bool ok = true;
+};
+
+static void fillCounters(Result& r, const PerfCounters& perf)
+{
+    if (!perf.available() || r.units == 0) return;
+    r.cycles       = (double)perf.total(PerfCounters::Cycles) / r.units;
+    r.branchMisses = (double)perf.total(PerfCounters::BranchMisses) / r.units;
+    r.cacheMisses  = (double)perf.total(PerfCounters::CacheMisses) / r.units;
+}
+
+static string counterText(double v)
+{
+    if (v < 0) return "n/a";
+    ostringstream out;
+    out << fixed << setprecision(2) << v;
+    return out.str();
+}
+
+static void printHeader()
+{
+    cout << left << setw(7) << "kind" << setw(22) << "algorithm" << setw(12) << "dist"
+         << right << setw(11) << "n" << setw(6) << "reps"
+         << setw(11) << "ns/elem" << setw(11) << "cycles" << setw(12) << "br-miss"
+         << setw(12) << "cache-miss" << "  check\n";
+}
+
+static void printRow(const Result& r)
+{
+    cout << left << setw(7) << r.kind << setw(22) << r.algorithm << setw(12) << r.distribution
+         << right << setw(11) << r.n << setw(6) << r.reps
+         << setw(11) << fixed << setprecision(2) << r.ns
+         << setw(11) << counterText(r.cycles)
+         << setw(12) << counterText(r.branchMisses)
+         << setw(12) << counterText(r.cacheMisses)
+         << "  " << (r.ok ? "OK" : "WRONG") << "\n";
+}
+
+static void printSkipped(const char* kind, const char* name, const string& dist, size_t n)
+{
+    cout << left << setw(7) << kind << setw(22) << name << setw(12) << dist
+         << right << setw(11) << n << "  skipped (quadratic here)\n";
+}
+
+static void writeCsv(const string& path, const vector<Result>& results)
+{
+    ofstream out(path);
+    out << "kind,algorithm,distribution,n,reps,ns_per_unit,cycles_per_unit,"
+           "branch_misses_per_unit,cache_misses_per_unit,ok\n";
+    for (const Result& r : results) {
+        out << r.kind << ',' << r.algorithm << ',' << r.distribution << ',' << r.n << ','
+            << r.reps << ',' << r.ns << ',';
+        if (r.cycles >= 0) out << r.cycles;
+        out << ',';
+        if (r.branchMisses >= 0) out << r.branchMisses;
+        out << ',';
+        if (r.cacheMisses >= 0) out << r.cacheMisses;
+        out << ',' << (r.ok ? 1 : 0) << "\n";
+    }
+    cout << "Wrote " << path << "\n";
+}
+
+static void writeJson(const string& path, const vector<Result>& results)
+{
+    auto number = [](double v) { return v < 0 ? string("null") : to_string(v); };
+
+    ofstream out(path);
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        out << "  {\"kind\": \"" << r.kind << "\", \"algorithm\": \"" << r.algorithm
+            << "\", \"distribution\": \"" << r.distribution << "\", \"n\": " << r.n
+            << ", \"reps\": " << r.reps << ", \"ns_per_unit\": " << number(r.ns)
+            << ", \"cycles_per_unit\": " << number(r.cycles)
+            << ", \"branch_misses_per_unit\": " << number(r.branchMisses)
+            << ", \"cache_misses_per_unit\": " << number(r.cacheMisses)
+            << ", \"ok\": " << (r.ok ? "true" : "false") << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+    cout << "Wrote " << path << "\n";
+}
+
+// ------------------------------------------------------------
+// Runners
+// ------------------------------------------------------------
+static bool skipped(Limit limit, const string& dist, size_t n)
+{
+    switch (limit) {
+        case Limit::Quadratic: return n > QUADRATIC_MAX_N;
+        case Limit::LastPivot: return dist != "random" && n > LAST_PIVOT_MAX_N;
+        case Limit::Linear:    return n > LINEAR_MAX_N;
+        default:               return false;
+    }
+}
+
+static Result runSort(const SortAlgo& algo, const string& dist, const vector<int>& input,
+                      const vector<int>& expected, PerfCounters& perf)
+{
+    Result r;
+    r.kind = "sort";
+    r.algorithm = algo.name;
+    r.distribution = dist;
+    r.n = input.size();
+    perf.reset();
+
+    double seconds = 0.0;
+    vector<int> work;
+    while (r.reps < MAX_REPS && (r.reps == 0 || seconds < MIN_SECONDS)) {
+        work = input;
+        perf.start();
+        auto t0 = chrono::steady_clock::now();
+        algo.run(work);
+        auto t1 = chrono::steady_clock::now();
+        perf.stop();
+
+        seconds += chrono::duration<double>(t1 - t0).count();
+        r.ok &= (work == expected);
+        r.reps++;
+    }
+
+    r.units = (long long)r.reps * (long long)r.n;
+    r.ns = seconds * 1e9 / (double)max<long long>(r.units, 1);
+    fillCounters(r, perf);
+    return r;
+}
+
+static Result runSearch(const SearchAlgo& algo, const string& dist, const vector<int>& sorted,
+                        const vector<int>& queries, PerfCounters& perf)
+{
+    Result r;
+    r.kind = "search";
+    r.algorithm = algo.name;
+    r.distribution = dist;
+    r.n = sorted.size();
+    perf.reset();
+    if (algo.prepare) algo.prepare(sorted);
+
+    double seconds = 0.0;
+    while (r.reps < MAX_REPS && (r.reps == 0 || seconds < MIN_SECONDS)) {
+        vector<int> answers(queries.size());
+
+        perf.start();
+        auto t0 = chrono::steady_clock::now();
+        if (algo.runBatch) {
+            algo.runBatch(sorted, queries, answers);
+        } else {
+            for (size_t q = 0; q < queries.size(); q++) answers[q] = algo.run(sorted, queries[q]);
+        }
+        auto t1 = chrono::steady_clock::now();
+        perf.stop();
+        seconds += chrono::duration<double>(t1 - t0).count();
+
+        // Found -> must point at the value; not found -> value must be absent
+        for (size_t q = 0; q < queries.size(); q++) {
+            int idx = answers[q];
+            if (idx >= 0) r.ok &= (idx < (int)sorted.size() && sorted[idx] == queries[q]);
+            else          r.ok &= !binary_search(sorted.begin(), sorted.end(), queries[q]);
+        }
+        r.reps++;
+    }
+
+    r.units = (long long)r.reps * (long long)queries.size();
+    r.ns = seconds * 1e9 / (double)max<long long>(r.units, 1);
+    fillCounters(r, perf);
+    return r;
+}
+
+// Half the queries are values from the array, half random in [min, max]
+static vector<int> makeQueries(const vector<int>& sorted, size_t count, uint64_t seed)
+{
+    mt19937_64 rng(seed);
+    vector<int> q(count);
+    if (sorted.empty()) return q;
+
+    long long lo = sorted.front(), hi = sorted.back();
+    for (size_t i = 0; i < count; i++) {
+        if (i % 2 == 0) q[i] = sorted[rng() % sorted.size()];
+        else            q[i] = (int)(lo + (long long)(rng() % (uint64_t)(hi - lo + 1)));
+    }
+    return q;
+}
+
+// ------------------------------------------------------------
+// Command line
+// ------------------------------------------------------------
+struct Options {
+    size_t minN = 1000;
+    size_t maxN = 1000000;
+    vector<string> dists;
+    string only;
+    string csvPath;
+    string jsonPath;
+    vector<string> dataPaths;
+    uint64_t seed = 12345;
+};
+
+static vector<string> splitList(const string& s)
+{
+    vector<string> parts;
+    string item;
+    istringstream in(s);
+    while (getline(in, item, ',')) {
+        if (!item.empty()) parts.push_back(item);
+    }
+    return parts;
+}
+
+static bool parseOptions(int argc, char** argv, Options& opt)
+{
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        string value = argv[++i];
+
+        if      (arg == "--min-n") opt.minN = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--max-n") opt.maxN = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--dist")  opt.dists = splitList(value);
+        else if (arg == "--only")  opt.only = value;
+        else if (arg == "--csv")   opt.csvPath = value;
+        else if (arg == "--json")  opt.jsonPath = value;
+        else if (arg == "--seed")  opt.seed = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--data")  opt.dataPaths = splitList(value);
+        else {
+            cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+
+    if (opt.dists.empty()) {
+        for (const char* d : DISTRIBUTIONS) opt.dists.push_back(d);
+    }
+    for (const string& d : opt.dists) {
+        if (find(begin(DISTRIBUTIONS), end(DISTRIBUTIONS), d) == end(DISTRIBUTIONS)) {
+            cerr << "Unknown distribution: " << d << "\n";
+            return false;
+        }
+    }
+    if (opt.minN == 0 || opt.maxN < opt.minN) {
+        cerr << "Need 0 < --min-n <= --max-n\n";
+        return false;
+    }
+    return true;
+}
+
+static bool selected(const Options& opt, const char* name)
+{
+    return opt.only.empty() || string(name).find(opt.only) != string::npos;
+}
+
+// ------------------------------------------------------------
+// Input files (--data)
+// ------------------------------------------------------------
+/*
+    loadDataFile()
+    --------------
+    Binary dataset (../common/binary_dataset.hpp) or text file of ints.
+    Prints what was loaded and how long it took.
+*/
+static bool loadDataFile(const string& path, vector<int>& out)
+{
+    auto t0 = chrono::steady_clock::now();
+    string format;
+
+    if (bindata::isDatasetFile(path)) {
+        bindata::MappedDataset data;
+        string error;
+        if (!data.open(path, &error)) {
+            cerr << path << ": " << error << "\n";
+            return false;
+        }
+        // Raw int32 is used straight from the mapping; the rest is decoded
+        bindata::Span<int32_t> view = data.values<int32_t>();
+        if (!view.empty()) {
+            out.assign(view.begin(), view.end());
+        } else if (!data.decode(out, &error)) {
+            cerr << path << ": " << error << "\n";
+            return false;
+        }
+        format = data.header().encoding == bindata::RAW ? "binary raw" : "binary delta+varint";
+    } else {
+        if (!loadIntsFast(path, out)) {
+            cerr << "Error reading: " << path << "\n";
+            return false;
+        }
+        format = "text";
+    }
+
+    auto t1 = chrono::steady_clock::now();
+    cout << "Loaded " << out.size() << " ints from " << path << " (" << format << ") in "
+         << fixed << setprecision(2) << chrono::duration<double, milli>(t1 - t0).count()
+         << " ms\n";
+    return true;
+}
+
+// Label for a --data file in the "dist" column: its name without folders
+static string dataLabel(const string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    return slash == string::npos ? path : path.substr(slash + 1);
+}
+
+/*
+    runInput()
+    ----------
+    Every selected sort on `input`, then every selected search on it sorted.
+*/
+static void runInput(const Options& opt, const string& dist, const vector<int>& input,
+                     PerfCounters& perf, vector<Result>& results, bool& allOk)
+{
+    size_t n = input.size();
+
+    // Reference answer for the sorts, and the input for the searches
+    vector<int> sorted = input;
+    sort(sorted.begin(), sorted.end());
+
+    for (const SortAlgo& algo : SORTS) {
+        if (!selected(opt, algo.name)) continue;
+        if (skipped(algo.limit, dist, n)) {
+            printSkipped("sort", algo.name, dist, n);
+            continue;
+        }
+        Result r = runSort(algo, dist, input, sorted, perf);
+        printRow(r);
+        allOk &= r.ok;
+        results.push_back(r);
+    }
+
+    for (const SearchAlgo& algo : SEARCHES) {
+        if (!selected(opt, algo.name)) continue;
+        if (skipped(algo.limit, dist, n)) {
+            printSkipped("search", algo.name, dist, n);
+            continue;
+        }
+        size_t count = (algo.limit == Limit::Linear) ? SLOW_QUERIES : SEARCH_QUERIES;
+        vector<int> queries = makeQueries(sorted, count, opt.seed ^ n);
+        Result r = runSearch(algo, dist, sorted, queries, perf);
+        printRow(r);
+        allOk &= r.ok;
+        results.push_back(r);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        cerr << "usage: benchmark [--min-n N] [--max-n N] [--dist a,b] [--only name]"
+                " [--csv file] [--json file] [--seed S] [--data file,...]\n";
+        return 2;
+    }
+
+    PerfCounters perf;
+    cout << "section12 benchmark (SIMD: " << simdLevelName(detectSimdLevel())
+         << ", perf counters: " << (perf.available() ? "on" : "n/a") << ")\n\n";
+
+    vector<Result> results;
+    bool allOk = true;
+
+    if (!opt.dataPaths.empty()) {
+        for (const string& path : opt.dataPaths) {
+            vector<int> input;
+            if (!loadDataFile(path, input)) return 1;
+            cout << "\n";
+            printHeader();
+            runInput(opt, dataLabel(path), input, perf, results, allOk);
+            cout << "\n";
+        }
+    } else {
+        printHeader();
+        for (size_t n = opt.minN; n <= opt.maxN; n *= 10) {
+            for (const string& dist : opt.dists) {
+                vector<int> input = generate(dist, n, opt.seed + n);
+                runInput(opt, dist, input, perf, results, allOk);
+            }
+            if (n > SIZE_MAX / 10) break;
+        }
+    }
+
+    cout << "\n";
+    if (!opt.csvPath.empty())  writeCsv(opt.csvPath, results);
+    if (!opt.jsonPath.empty()) writeJson(opt.jsonPath, results);
+
+    cout << (allOk ? "SUCCESS — every result checked out." : "FAIL — see WRONG rows above.") << "\n";
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*
+    load_benchmark.cpp
+    ------------------
+    Load-time comparison for ../common/fast_loader.hpp and the binary
+    format in ../common/binary_dataset.hpp.
+
+    Writes a text file of N random ints (one line, space separated, like
+    unordered.txt) plus the same values as binary datasets, then loads them
+    and checks every method agrees:
+
+        ifstream >> int     the original loadFile() loop, no reserve()
+        loadIntsFast()      mmap + capacity estimate + hand-written parser
+        fread blocks        the same parser on 1 MB fread() blocks
+                            (the non-POSIX / fallback path)
+        binary span         raw int32 file mmap()ed, used in place (timed
+                            with one pass over the values, or nothing
+                            would be read at all)
+        binary -> vector    raw int32 file copied into a vector
+        delta+varint        the values sorted, delta + varint encoded,
+                            decoded into a vector (the ordered.txt case)
+
+    USAGE
+    -----
+        load_benchmark [N] [file]
+            N     number of ints (default 10,000,000; 100,000,000 is ~1.1 GB)
+            file  scratch file to write (default load_benchmark_data.txt;
+                  .raw.bin / .delta.bin are written next to it; all
+                  removed afterwards)
+
+    BUILD (from this folder)
+    -----
+        g++ -std=c++17 -O2 load_benchmark.cpp -o load_benchmark
+*/
+
+#include <chrono>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../common/fast_loader.hpp"
+#include "../common/binary_dataset.hpp"
+
+using namespace std;
+
+static void writeData(const string& path, size_t n)
+{
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(-1000000000, 1000000000);
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        cerr << "Cannot write " << path << "\n";
+        exit(1);
+    }
+    char num[16];
+    for (size_t i = 0; i < n; i++) {
+        int len = snprintf(num, sizeof(num), i + 1 < n ? "%d " : "%d\n", dist(rng));
+        fwrite(num, 1, (size_t)len, f);
+    }
+    fclose(f);
+}
+
+template <class LoadFn>
+static double timeLoad(const string& name, LoadFn load, vector<int>& out)
+{
+    auto t0 = chrono::steady_clock::now();
+    load(out);
+    auto t1 = chrono::steady_clock::now();
+    double ms = chrono::duration<double, milli>(t1 - t0).count();
+
+    cout << "  " << name;
+    for (size_t pad = name.size(); pad < 18; pad++) cout << ' ';
+    cout << ms << " ms  (" << out.size() << " ints)\n";
+    return ms;
+}
+
+// Parses a positive decimal count; false for "", "--help", "-5", "12x", "0"
+static bool parseCount(const char* text, size_t& n)
+{
+    if (*text < '0' || *text > '9') return false;
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long value = strtoull(text, &end, 10);
+    if (*end != '\0' || errno == ERANGE || value == 0) return false;
+    n = (size_t)value;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = 10000000;
+    if (argc > 3 || (argc > 1 && !parseCount(argv[1], n))) {
+        cerr << "usage: load_benchmark [N] [file]   (N = number of ints, > 0)\n";
+        return 2;
+    }
+    string path = argc > 2 ? argv[2] : "load_benchmark_data.txt";
+
+    cout << "Writing " << n << " ints to " << path << "...\n";
+    writeData(path, n);
+
+    // Touch the file once so every method reads it from the page cache
+    vector<int> warm;
+    loadIntsFast(path, warm);
+    warm.clear();
+    warm.shrink_to_fit();
+
+    cout << "\nLoad times:\n";
+    vector<int> viaStream, viaMmap, viaFread;
+
+    double streamMs = timeLoad("ifstream >> int", [&](vector<int>& out) {
+        ifstream in(path);
+        int x;
+        while (in >> x) out.push_back(x);
+    }, viaStream);
+
+    double mmapMs = timeLoad("loadIntsFast", [&](vector<int>& out) {
+        loadIntsFast(path, out);
+    }, viaMmap);
+
+    double freadMs = timeLoad("fread blocks", [&](vector<int>& out) {
+        fastload::loadBuffered(path, out);
+    }, viaFread);
+
+    // Binary copies of the same data (raw as is, delta+varint sorted)
+    string rawPath = path + ".raw.bin";
+    string deltaPath = path + ".delta.bin";
+    vector<int32_t> sortedValues(viaStream.begin(), viaStream.end());
+    sort(sortedValues.begin(), sortedValues.end());
+    string error;
+    bool ok = bindata::writeDataset(rawPath, vector<int32_t>(viaStream.begin(), viaStream.end()),
+                                    bindata::RAW, &error) &&
+              bindata::writeDataset(deltaPath, sortedValues, bindata::DELTA_VARINT, &error);
+    if (!ok) cerr << error << "\n";
+
+    long long spanSum = 0;
+    vector<int> viaSpan, viaBinary, viaDelta;
+
+    double spanMs = timeLoad("binary span", [&](vector<int>& out) {
+        bindata::MappedDataset data;
+        if (!data.open(rawPath, nullptr)) return;
+        bindata::Span<int32_t> view = data.values<int32_t>();
+        for (int32_t v : view) spanSum += v;
+        out.resize(view.size());  // only so the row shows a count; not timed work
+    }, viaSpan);
+
+    double binaryMs = timeLoad("binary -> vector", [&](vector<int>& out) {
+        bindata::MappedDataset data;
+        if (data.open(rawPath, nullptr)) data.decode(out);
+    }, viaBinary);
+
+    double deltaMs = timeLoad("delta+varint", [&](vector<int>& out) {
+        bindata::MappedDataset data;
+        if (data.open(deltaPath, nullptr)) data.decode(out);
+    }, viaDelta);
+
+    long long expectedSum = 0;
+    for (int v : viaStream) expectedSum += v;
+
+    ok &= (viaStream.size() == n) && viaStream == viaMmap && viaStream == viaFread &&
+          viaStream == viaBinary && spanSum == expectedSum &&
+          vector<int>(sortedValues.begin(), sortedValues.end()) == viaDelta;
+
+    cout << "\nSpeedup vs ifstream: loadIntsFast " << streamMs / mmapMs
+         << "x, fread blocks " << streamMs / freadMs << "x, binary span "
+         << streamMs / spanMs << "x, binary -> vector " << streamMs / binaryMs
+         << "x, delta+varint " << streamMs / deltaMs << "x\n";
+    cout << (ok ? "SUCCESS — all loaders agree." : "FAIL — loaders disagree.") << "\n";
+
+    remove(path.c_str());
+    remove(rawPath.c_str());
+    remove(deltaPath.c_str());
+    return ok ? 0 : 1;
+}
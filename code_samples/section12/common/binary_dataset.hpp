@@ -0,0 +1,466 @@
+/*
+    binary_dataset.hpp
+    ------------------
+    Compact binary format for the section12 test data, so programs that run
+    the same inputs over and over do not re-parse text every time.
+
+    FILE LAYOUT (all fields little-endian)
+    -----------
+        offset  size  field
+             0     4  magic "S12D"
+             4     2  version (1)
+             6     1  encoding: 0 = raw, 1 = delta + varint
+             7     1  bytes per element: 4 (int32) or 8 (int64)
+             8     8  element count
+            16     8  payload bytes
+            24     8  reserved (0)
+            32     -  payload
+
+    RAW
+    ---
+    The values as a plain little-endian int32/int64 array. The payload
+    starts 32 bytes into the file, so in an mmap()ed file it is suitably
+    aligned and can be used in place: MappedDataset::values<T>() returns a
+    span over the mapping with no parsing and no copy.
+
+    DELTA + VARINT
+    --------------
+    For sorted data. Each value is stored as the difference to the previous
+    one (the first one as is), zigzag-mapped so small negative differences
+    stay small too, then written 7 bits per byte (LEB128: high bit = "more
+    bytes follow"). Sorted 10k-in-[-5000, 5000] data needs ~1 byte per
+    value instead of 4. Not usable in place: decode() expands it.
+
+    USAGE
+    -----
+        bindata::writeDataset("ordered.bin", values, bindata::RAW, &error);
+
+        bindata::MappedDataset data;
+        if (!data.open("ordered.bin", &error)) { ... }
+        bindata::Span<int32_t> view = data.values<int32_t>();  // raw only
+        vector<int> copy;
+        data.decode(copy);                                     // any encoding
+
+    tools/convert_dataset.cpp converts the .txt files.
+*/
+
+#ifndef SECTION12_BINARY_DATASET_HPP
+#define SECTION12_BINARY_DATASET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define BINARY_DATASET_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #define BINARY_DATASET_MMAP 0
+#endif
+
+namespace bindata {
+
+static const char     MAGIC[4]     = { 'S', '1', '2', 'D' };
+static const uint16_t VERSION      = 1;
+static const size_t   HEADER_BYTES = 32;
+
+enum Encoding : uint8_t {
+    RAW          = 0,
+    DELTA_VARINT = 1
+};
+
+struct Header {
+    Encoding encoding = RAW;
+    uint8_t  elemBytes = 4;
+    uint64_t count = 0;
+    uint64_t payloadBytes = 0;
+};
+
+// Read-only view of count elements (std::span is C++20)
+template <class T>
+struct Span {
+    const T* ptr = nullptr;
+    size_t   len = 0;
+
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + len; }
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    const T& operator[](size_t i) const { return ptr[i]; }
+};
+
+// ------------------------------------------------------------
+// Little-endian helpers (the format does not depend on the host)
+// ------------------------------------------------------------
+inline bool hostIsLittleEndian()
+{
+    const uint16_t one = 1;
+    unsigned char first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+inline void putLE(unsigned char* p, uint64_t v, int bytes)
+{
+    for (int i = 0; i < bytes; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+inline uint64_t getLE(const unsigned char* p, int bytes)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < bytes; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+inline uint64_t zigzag(int64_t v)    { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+inline int64_t  unzigzag(uint64_t u) { return (int64_t)(u >> 1) ^ -(int64_t)(u & 1); }
+
+inline void setError(std::string* error, const std::string& message)
+{
+    if (error) *error = message;
+}
+
+/*
+    parseHeader()
+    -------------
+    Checks magic, version, encoding and sizes against the file length.
+    The count is checked by dividing the payload size, never by multiplying
+    the count (a crafted count near 2^64 would wrap around).
+*/
+inline bool parseHeader(const unsigned char* p, size_t fileBytes, Header& h, std::string* error)
+{
+    if (fileBytes < HEADER_BYTES || std::memcmp(p, MAGIC, 4) != 0) {
+        setError(error, "not a section12 binary dataset");
+        return false;
+    }
+    if (getLE(p + 4, 2) != VERSION) {
+        setError(error, "unsupported dataset version");
+        return false;
+    }
+
+    h.encoding     = (Encoding)p[6];
+    h.elemBytes    = p[7];
+    h.count        = getLE(p + 8, 8);
+    h.payloadBytes = getLE(p + 16, 8);
+
+    if (h.encoding != RAW && h.encoding != DELTA_VARINT) {
+        setError(error, "unknown encoding");
+        return false;
+    }
+    if (h.elemBytes != 4 && h.elemBytes != 8) {
+        setError(error, "element size must be 4 or 8 bytes");
+        return false;
+    }
+    if (h.payloadBytes > fileBytes - HEADER_BYTES) {
+        setError(error, "truncated or inconsistent dataset");
+        return false;
+    }
+    // RAW: exactly count elements; DELTA_VARINT: at least 1 byte per value
+    bool countOk = h.encoding == RAW
+        ? h.payloadBytes % h.elemBytes == 0 && h.count == h.payloadBytes / h.elemBytes
+        : h.count <= h.payloadBytes;
+    if (!countOk) {
+        setError(error, "truncated or inconsistent dataset");
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------
+// Writing
+// ------------------------------------------------------------
+/*
+    writeDataset()
+    --------------
+    Writes values (int32_t or int64_t elements) with the given encoding.
+    Returns false and sets *error if the file cannot be written.
+*/
+template <class T>
+bool writeDataset(const std::string& path, const std::vector<T>& values, Encoding encoding,
+                  std::string* error)
+{
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value &&
+                  (sizeof(T) == 4 || sizeof(T) == 8), "int32_t or int64_t elements");
+    const int elemBytes = (int)sizeof(T);
+
+    std::vector<unsigned char> payload;
+    if (encoding == RAW) {
+        payload.resize(values.size() * elemBytes);
+        for (size_t i = 0; i < values.size(); i++) {
+            putLE(&payload[i * elemBytes], (uint64_t)(int64_t)values[i], elemBytes);
+        }
+    } else {
+        payload.reserve(values.size() + 16);
+        uint64_t prev = 0;
+        for (size_t i = 0; i < values.size(); i++) {
+            // Unsigned wrap-around keeps int64 differences well defined
+            uint64_t cur = (uint64_t)(int64_t)values[i];
+            uint64_t u = zigzag((int64_t)(cur - prev));
+            prev = cur;
+            while (u >= 0x80) {
+                payload.push_back((unsigned char)(u | 0x80));
+                u >>= 7;
+            }
+            payload.push_back((unsigned char)u);
+        }
+    }
+
+    unsigned char header[HEADER_BYTES] = { 0 };
+    std::memcpy(header, MAGIC, 4);
+    putLE(header + 4, VERSION, 2);
+    header[6] = (unsigned char)encoding;
+    header[7] = (unsigned char)elemBytes;
+    putLE(header + 8, values.size(), 8);
+    putLE(header + 16, payload.size(), 8);
+
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        setError(error, "cannot write " + path);
+        return false;
+    }
+    bool ok = std::fwrite(header, 1, HEADER_BYTES, f) == HEADER_BYTES &&
+              std::fwrite(payload.data(), 1, payload.size(), f) == payload.size();
+    ok &= (std::fclose(f) == 0);
+    if (!ok) setError(error, "short write to " + path);
+    return ok;
+}
+
+// ------------------------------------------------------------
+// Reading
+// ------------------------------------------------------------
+/*
+    MappedDataset
+    -------------
+    Owns an open dataset: mmap()ed on POSIX, read into memory otherwise.
+    Move-only; the mapping (and every Span handed out) lives as long as
+    the object.
+*/
+class MappedDataset {
+public:
+    MappedDataset() = default;
+    ~MappedDataset() { close(); }
+
+    MappedDataset(const MappedDataset&) = delete;
+    MappedDataset& operator=(const MappedDataset&) = delete;
+
+    MappedDataset(MappedDataset&& other) noexcept { *this = std::move(other); }
+    MappedDataset& operator=(MappedDataset&& other) noexcept
+    {
+        if (this != &other) {
+            close();
+            base_ = other.base_;
+            bytes_ = other.bytes_;
+            mapped_ = other.mapped_;
+            owned_.swap(other.owned_);
+            header_ = other.header_;
+            other.base_ = nullptr;
+            other.bytes_ = 0;
+            other.mapped_ = false;
+        }
+        return *this;
+    }
+
+    bool open(const std::string& path, std::string* error)
+    {
+        close();
+        if (!mapFile(path) && !readFile(path)) {
+            setError(error, "cannot open " + path);
+            return false;
+        }
+        if (!parseHeader(base_, bytes_, header_, error)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close()
+    {
+#if BINARY_DATASET_MMAP
+        if (mapped_) munmap((void*)base_, bytes_);
+#endif
+        std::vector<unsigned char>().swap(owned_);
+        base_ = nullptr;
+        bytes_ = 0;
+        mapped_ = false;
+        header_ = Header();
+    }
+
+    bool isOpen() const { return base_ != nullptr; }
+    bool isMapped() const { return mapped_; }
+    const Header& header() const { return header_; }
+    size_t size() const { return (size_t)header_.count; }
+
+    /*
+        values<T>()
+        -----------
+        Zero-copy view of a RAW file whose elements are exactly T.
+        Empty span for any other file (delta-encoded, other element size,
+        or a big-endian host) - use decode() for those.
+    */
+    template <class T>
+    Span<T> values() const
+    {
+        Span<T> s;
+        if (!isOpen() || header_.encoding != RAW || header_.elemBytes != sizeof(T) ||
+            !hostIsLittleEndian()) return s;
+        s.ptr = reinterpret_cast<const T*>(base_ + HEADER_BYTES);
+        s.len = (size_t)header_.count;
+        return s;
+    }
+
+    /*
+        decode()
+        --------
+        Copies / expands every value into out (replacing its contents).
+        Fails if a value would not fit in T or the payload is corrupt.
+    */
+    template <class T>
+    bool decode(std::vector<T>& out, std::string* error = nullptr) const
+    {
+        static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                      "signed integer elements");
+        if (!isOpen()) {
+            setError(error, "dataset not open");
+            return false;
+        }
+        if (header_.elemBytes > sizeof(T)) {
+            setError(error, "elements do not fit the requested type");
+            return false;
+        }
+
+        // parseHeader() already bounds count by the payload size; checked
+        // again so a bad count can never reach resize()
+        const unsigned char* p = base_ + HEADER_BYTES;
+        const int elemBytes = header_.elemBytes;
+        if (header_.count > header_.payloadBytes) {
+            setError(error, "truncated or inconsistent dataset");
+            return false;
+        }
+        size_t n = (size_t)header_.count;
+        try {
+            out.resize(n);
+        } catch (const std::exception&) {   // bad_alloc / length_error
+            out.clear();
+            setError(error, "not enough memory for " + std::to_string(n) + " values");
+            return false;
+        }
+
+        if (header_.encoding == RAW) {
+            if (elemBytes == (int)sizeof(T) && hostIsLittleEndian()) {
+                std::memcpy(out.data(), p, n * sizeof(T));
+                return true;
+            }
+            for (size_t i = 0; i < n; i++) out[i] = (T)signExtend(getLE(p + i * elemBytes, elemBytes), elemBytes);
+            return true;
+        }
+
+        const unsigned char* end = p + header_.payloadBytes;
+        uint64_t prev = 0;
+        for (size_t i = 0; i < n; i++) {
+            uint64_t u = 0;
+            int shift = 0;
+            for (;;) {
+                if (p == end || shift > 63) {
+                    out.clear();
+                    setError(error, "corrupt varint payload");
+                    return false;
+                }
+                unsigned char b = *p++;
+                u |= (uint64_t)(b & 0x7F) << shift;
+                if (!(b & 0x80)) break;
+                shift += 7;
+            }
+            prev += (uint64_t)unzigzag(u);
+            out[i] = (T)signExtend(prev, elemBytes);
+        }
+        return true;
+    }
+
+private:
+    static int64_t signExtend(uint64_t v, int bytes)
+    {
+        return bytes == 4 ? (int64_t)(int32_t)(uint32_t)v : (int64_t)v;
+    }
+
+    bool mapFile(const std::string& path)
+    {
+#if BINARY_DATASET_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+#ifdef MAP_POPULATE
+        const int flags = MAP_PRIVATE | MAP_POPULATE;  // Linux: no fault per page later
+#else
+        const int flags = MAP_PRIVATE;
+#endif
+        void* map = mmap(nullptr, (size_t)st.st_size, PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) return false;
+
+        base_ = (const unsigned char*)map;
+        bytes_ = (size_t)st.st_size;
+        mapped_ = true;
+        return true;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    bool readFile(const std::string& path)
+    {
+        FILE* f = std::fopen(path.c_str(), "rb");
+        if (!f) return false;
+
+        unsigned char block[1 << 16];
+        size_t got;
+        while ((got = std::fread(block, 1, sizeof(block), f)) > 0) {
+            owned_.insert(owned_.end(), block, block + got);
+        }
+        std::fclose(f);
+
+        // operator new storage is aligned for any scalar, so is payload + 32
+        base_ = owned_.data();
+        bytes_ = owned_.size();
+        return base_ != nullptr;
+    }
+
+    const unsigned char* base_ = nullptr;
+    size_t bytes_ = 0;
+    bool mapped_ = false;
+    std::vector<unsigned char> owned_;
+    Header header_;
+};
+
+/*
+    isDatasetFile()
+    ---------------
+    True if the file at path starts with the dataset magic.
+*/
+inline bool isDatasetFile(const std::string& path)
+{
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+    char magic[4] = { 0 };
+    bool match = std::fread(magic, 1, 4, f) == 4 && std::memcmp(magic, MAGIC, 4) == 0;
+    std::fclose(f);
+    return match;
+}
+
+} // namespace bindata
+
+#endif // SECTION12_BINARY_DATASET_HPP
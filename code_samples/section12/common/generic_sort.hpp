@@ -0,0 +1,441 @@
+/*
+    generic_sort.hpp
+    ----------------
+    The section12 sorts as iterator + comparator templates - the ONE
+    implementation of each; the int examples call these:
+
+        gsort::quickSort      (median of three + three-way partition)
+        gsort::mergeSort      (top-down, one temp buffer, stable)
+        gsort::heapSort       (binary max-heap)
+        gsort::insertionSort  (stable)
+        gsort::selectionSort
+        gsort::bubbleSort     (stable, stops after a pass with no swaps)
+
+    plus the building blocks the examples use on their own:
+
+        gsort::lomutoPartition  partition() of quick_sort.cpp (last element
+                                as pivot), the scalar reference for its
+                                SIMD partitions
+        gsort::partition3       < | == | > split (quickSort, nthElement)
+        gsort::mergeAdjacent    merge step of merge_sort.cpp
+
+    selection_sort.cpp, bubble_sort.cpp, insertion_sort.cpp, merge_sort.cpp
+    and heap_sort.cpp run these templates with a counting policy, so the
+    step counts they print come from here.
+
+    USAGE
+    -----
+        gsort::quickSort(v.begin(), v.end());                     // ints, <
+        gsort::mergeSort(v.begin(), v.end(), std::greater<>());   // descending
+        gsort::heapSort(recs.begin(), recs.end(),
+                        [](const Rec& a, const Rec& b) { return a.key < b.key; });
+
+        gsort::CountStats stats;
+        gsort::insertionSort(v.begin(), v.end(), std::less<>(), stats);
+
+    COMPARATOR
+    ----------
+    Like std::sort: cmp(a, b) == true means "a goes before b" (strict weak
+    ordering). The int examples' "<=" becomes !cmp(b, a), ">" becomes
+    cmp(b, a), and so on.
+
+    STATS POLICY
+    ------------
+    The last template parameter is a counting policy:
+
+        NoStats    - every hook is an empty inline function. This is the
+                     default, and the optimizer removes the calls entirely,
+                     so the int path compiles to the same loop as a
+                     hand-written int-only sort.
+        CountStats - comparisons, writes and swaps, counted the same way as
+                     the examples (a swap is 3 writes: tmp + a + b).
+
+    Any struct with compare(), write(n) and swap() members can be used.
+
+    Everything is a template over RandomIt, so it works for int, long long,
+    float, and records with a key (see example_15_generic_sort).
+*/
+
+#ifndef SECTION12_GENERIC_SORT_HPP
+#define SECTION12_GENERIC_SORT_HPP
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace gsort {
+
+// ------------------------------------------------------------
+// Stats policies
+// ------------------------------------------------------------
+struct NoStats {
+    void compare() {}
+    void write(long long = 1) {}
+    void swap() {}
+};
+
+struct CountStats {
+    long long comparisons = 0;
+    long long writes = 0;
+    long long swaps = 0;
+
+    void compare() { comparisons++; }
+    void write(long long n = 1) { writes += n; }
+    void swap() { swaps++; writes += 3; }
+};
+
+namespace detail {
+
+template <class RandomIt, class Stats>
+inline void swapCounted(RandomIt a, RandomIt b, Stats& stats)
+{
+    using std::swap;
+    swap(*a, *b);
+    stats.swap();
+}
+
+} // namespace detail
+
+// ------------------------------------------------------------
+// Building blocks
+// ------------------------------------------------------------
+/*
+    lomutoPartition()
+    -----------------
+    Lomuto partition on [first, last] (inclusive last = pivot): elements
+    with !(pivot < x), i.e. x <= pivot, move left, then the pivot goes
+    between the two sides. Returns its final position. Keys equal to the
+    pivot all go LEFT, so all-equal input splits 0 / n-1 (see partition3).
+*/
+template <class RandomIt, class Compare, class Stats>
+RandomIt lomutoPartition(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    RandomIt i = first;
+    for (RandomIt j = first; j != last; ++j) {
+        stats.compare();
+        if (!cmp(*last, *j)) {
+            detail::swapCounted(i, j, stats);
+            ++i;
+        }
+    }
+    detail::swapCounted(i, last, stats);
+    return i;
+}
+
+/*
+    partition3()
+    ------------
+    Three-way partition of [first, last) around the value pivot (a copy,
+    not a reference into the range). Returns [eqFirst, eqLast):
+
+        [first, eqFirst)    <  pivot
+        [eqFirst, eqLast)   == pivot (neither compares less)
+        [eqLast, last)      >  pivot
+
+    Bentley-McIlroy scheme: b scans up and c scans down like a Hoare
+    partition, swapping only pairs that are on the wrong side, and keys
+    equal to the pivot are parked at the two ends (a, d) and swapped into
+    the middle at the end. Already-partitioned data is left in place, so
+    sorted input stays sorted for the next median-of-three.
+
+    1-2 comparisons per element. Keys equal to the pivot are finished in
+    this pass, so duplicates cannot make quickSort or selection quadratic.
+*/
+template <class RandomIt, class T, class Compare, class Stats>
+std::pair<RandomIt, RandomIt> partition3(RandomIt first, RandomIt last, const T& pivot,
+                                         Compare cmp, Stats& stats)
+{
+    // [first, a) ==   [a, b) <   [b, c) unscanned   [c, d) >   [d, last) ==
+    RandomIt a = first, b = first, c = last, d = last;
+    for (;;) {
+        while (b != c) {
+            stats.compare();
+            if (cmp(pivot, *b)) break;
+            stats.compare();
+            if (!cmp(*b, pivot)) detail::swapCounted(a++, b, stats);
+            ++b;
+        }
+        while (b != c) {
+            stats.compare();
+            if (cmp(*(c - 1), pivot)) break;
+            --c;
+            stats.compare();
+            if (!cmp(pivot, *c)) detail::swapCounted(c, --d, stats);
+        }
+        if (b == c) break;
+        --c;
+        detail::swapCounted(b++, c, stats);
+    }
+
+    // Move the parked equal keys from both ends into the middle
+    auto lessCount = b - a;
+    auto greaterCount = d - c;
+    auto n = std::min(a - first, lessCount);
+    for (decltype(n) k = 0; k < n; k++) detail::swapCounted(first + k, b - n + k, stats);
+    n = std::min(last - d, greaterCount);
+    for (decltype(n) k = 0; k < n; k++) detail::swapCounted(b + k, last - n + k, stats);
+
+    return { first + lessCount, last - greaterCount };
+}
+
+/*
+    mergeAdjacent()
+    ---------------
+    Merges the sorted ranges [first, mid) and [mid, last) through tmp (room
+    for last - first elements) and copies the result back. Ties take the
+    left element (stable).
+*/
+template <class RandomIt, class T, class Compare, class Stats>
+void mergeAdjacent(RandomIt first, RandomIt mid, RandomIt last,
+                   T* tmp, Compare cmp, Stats& stats)
+{
+    RandomIt i = first, j = mid;
+    T* k = tmp;
+
+    while (i != mid && j != last) {
+        stats.compare();
+        if (!cmp(*j, *i)) *k++ = std::move(*i++);
+        else              *k++ = std::move(*j++);
+        stats.write();
+    }
+    while (i != mid)  { *k++ = std::move(*i++); stats.write(); }
+    while (j != last) { *k++ = std::move(*j++); stats.write(); }
+
+    for (T* p = tmp; p != k; ++p, ++first) {
+        *first = std::move(*p);
+        stats.write();
+    }
+}
+
+namespace detail {
+
+template <class RandomIt, class T, class Compare, class Stats>
+void mergeSortRec(RandomIt first, RandomIt last, T* tmp, Compare& cmp, Stats& stats)
+{
+    auto n = last - first;
+    if (n <= 1) return;
+
+    RandomIt mid = first + n / 2;
+    mergeSortRec(first, mid, tmp, cmp, stats);
+    mergeSortRec(mid, last, tmp + n / 2, cmp, stats);
+    mergeAdjacent(first, mid, last, tmp, cmp, stats);
+}
+
+/*
+    heapify()
+    ---------
+    Sift-down of node i in a max-heap of n elements: swap with the larger
+    child until neither child is larger.
+*/
+template <class RandomIt, class Diff, class Compare, class Stats>
+void heapify(RandomIt first, Diff n, Diff i, Compare& cmp, Stats& stats)
+{
+    for (;;) {
+        Diff largest = i;
+        Diff left = 2 * i + 1;
+        Diff right = 2 * i + 2;
+
+        if (left < n) {
+            stats.compare();
+            if (cmp(first[largest], first[left])) largest = left;
+        }
+        if (right < n) {
+            stats.compare();
+            if (cmp(first[largest], first[right])) largest = right;
+        }
+        if (largest == i) return;
+
+        swapCounted(first + i, first + largest, stats);
+        i = largest;
+    }
+}
+
+} // namespace detail
+
+// ------------------------------------------------------------
+// quickSort
+// ------------------------------------------------------------
+/*
+    Pivot = median of the first, middle and last element (sorted and
+    reverse-sorted input split evenly), then partition3(): keys equal to
+    the pivot are finished in the same pass, so all-equal input takes one
+    pass instead of n. Recurses into the smaller side and loops on the
+    larger one, so the stack depth stays O(log n).
+*/
+template <class RandomIt, class Compare, class Stats>
+void quickSort(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+
+    while (last - first > 1) {
+        // Median of three -> *mid
+        RandomIt mid = first + (last - first) / 2;
+        RandomIt back = last - 1;
+        stats.compare();
+        if (cmp(*mid, *first)) detail::swapCounted(mid, first, stats);
+        stats.compare();
+        if (cmp(*back, *mid)) {
+            detail::swapCounted(back, mid, stats);
+            stats.compare();
+            if (cmp(*mid, *first)) detail::swapCounted(mid, first, stats);
+        }
+
+        const T pivot = *mid;
+        std::pair<RandomIt, RandomIt> eq = partition3(first, last, pivot, cmp, stats);
+
+        if (eq.first - first < last - eq.second) {
+            quickSort(first, eq.first, cmp, stats);
+            first = eq.second;
+        } else {
+            quickSort(eq.second, last, cmp, stats);
+            last = eq.first;
+        }
+    }
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void quickSort(RandomIt first, RandomIt last, Compare cmp = Compare())
+{
+    NoStats stats;
+    quickSort(first, last, cmp, stats);
+}
+
+// ------------------------------------------------------------
+// mergeSort
+// ------------------------------------------------------------
+template <class RandomIt, class Compare, class Stats>
+void mergeSort(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    if (last - first <= 1) return;
+
+    // One temp buffer reused by every merge
+    std::vector<T> tmp(static_cast<size_t>(last - first));
+    detail::mergeSortRec(first, last, tmp.data(), cmp, stats);
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void mergeSort(RandomIt first, RandomIt last, Compare cmp = Compare())
+{
+    NoStats stats;
+    mergeSort(first, last, cmp, stats);
+}
+
+// ------------------------------------------------------------
+// heapSort
+// ------------------------------------------------------------
+template <class RandomIt, class Compare, class Stats>
+void heapSort(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+    Diff n = last - first;
+    if (n <= 1) return;
+
+    // 1) Build max-heap from the last parent down to the root
+    for (Diff i = n / 2 - 1; i >= 0; --i) {
+        detail::heapify(first, n, i, cmp, stats);
+    }
+
+    // 2) Move the max to the end, shrink the heap, restore the root
+    for (Diff end = n - 1; end > 0; --end) {
+        detail::swapCounted(first, first + end, stats);
+        detail::heapify(first, end, Diff(0), cmp, stats);
+    }
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void heapSort(RandomIt first, RandomIt last, Compare cmp = Compare())
+{
+    NoStats stats;
+    heapSort(first, last, cmp, stats);
+}
+
+// ------------------------------------------------------------
+// insertionSort
+// ------------------------------------------------------------
+template <class RandomIt, class Compare, class Stats>
+void insertionSort(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    if (last - first <= 1) return;
+
+    for (RandomIt i = first + 1; i != last; ++i) {
+        T key = std::move(*i);
+        RandomIt j = i;
+
+        // Shift larger elements one slot to the right
+        while (j != first) {
+            stats.compare();
+            if (!cmp(key, *(j - 1))) break;
+            *j = std::move(*(j - 1));
+            stats.write();
+            --j;
+        }
+
+        *j = std::move(key);
+        stats.write();
+    }
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void insertionSort(RandomIt first, RandomIt last, Compare cmp = Compare())
+{
+    NoStats stats;
+    insertionSort(first, last, cmp, stats);
+}
+
+// ------------------------------------------------------------
+// selectionSort
+// ------------------------------------------------------------
+template <class RandomIt, class Compare, class Stats>
+void selectionSort(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    for (RandomIt i = first; i != last; ++i) {
+        RandomIt minIt = i;
+        for (RandomIt j = i + 1; j != last; ++j) {
+            stats.compare();
+            if (cmp(*j, *minIt)) minIt = j;
+        }
+        if (minIt != i) detail::swapCounted(i, minIt, stats);
+    }
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void selectionSort(RandomIt first, RandomIt last, Compare cmp = Compare())
+{
+    NoStats stats;
+    selectionSort(first, last, cmp, stats);
+}
+
+// ------------------------------------------------------------
+// bubbleSort
+// ------------------------------------------------------------
+template <class RandomIt, class Compare, class Stats>
+void bubbleSort(RandomIt first, RandomIt last, Compare cmp, Stats& stats)
+{
+    bool swapped = true;
+    while (swapped && last - first > 1) {
+        swapped = false;
+        for (RandomIt i = first + 1; i != last; ++i) {
+            stats.compare();
+            if (cmp(*i, *(i - 1))) {
+                detail::swapCounted(i - 1, i, stats);
+                swapped = true;
+            }
+        }
+        --last;  // largest remaining element is now in place
+    }
+}
+
+template <class RandomIt, class Compare = std::less<>>
+void bubbleSort(RandomIt first, RandomIt last, Compare cmp = Compare())
+{
+    NoStats stats;
+    bubbleSort(first, last, cmp, stats);
+}
+
+} // namespace gsort
+
+#endif // SECTION12_GENERIC_SORT_HPP
@@ -0,0 +1,401 @@
+/*
+    sorting_networks.hpp
+    --------------------
+    Branch-free sorting-network kernels for tiny int arrays (8, 16, 32 values),
+    used as leaf cases by the divide-and-conquer sorts (quick_sort.cpp,
+    merge_sort.cpp).
+
+    WHY A SORTING NETWORK?
+    ----------------------
+    Once quick sort / merge sort recurse down to a few dozen elements, the
+    usual base case (insertion sort) spends most of its time on unpredictable
+    branches. A SORTING NETWORK is a FIXED sequence of compare-exchange steps:
+
+        lo = min(a, b)
+        hi = max(a, b)
+
+    The sequence never depends on the data, so there are no branches to
+    mispredict, and many compare-exchanges can run at once in SIMD registers.
+
+    This file uses BITONIC networks:
+      - sort 8 ints inside one AVX2 register (or two SSE registers)
+      - merge two sorted registers: reverse one, take lane-wise min/max,
+        then "clean" each half with 3 more in-register steps
+      - 16 and 32 ints = sorted registers merged with the same idea
+
+    DISPATCH
+    --------
+    detectSimdLevel() checks CPUID once at runtime:
+        AVX2   -> 8 ints per register (AVX-512 machines use these kernels too)
+        SSE4.1 -> 4 ints per register
+        else   -> scalar network (same comparators, plain min/max)
+
+    The SIMD code is compiled with per-function target attributes, so the
+    file builds without -mavx2 and still runs on CPUs without AVX2.
+    (GCC/Clang on x86; other compilers/CPUs get the scalar path.)
+
+    COST (comparators in the padded network)
+    ----------------------------------------
+        8 ints  ->  24 comparators  (6 vector steps with AVX2)
+        16 ints ->  80 comparators
+        32 ints -> 240 comparators
+
+    That is MORE comparisons than insertion sort needs on average, but they
+    are branch-free and 4-8 wide, which is what makes the kernels fast.
+*/
+
+#ifndef SECTION12_SORTING_NETWORKS_HPP
+#define SECTION12_SORTING_NETWORKS_HPP
+
+#include <algorithm>
+#include <climits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define SORTNET_X86 1
+    #include <immintrin.h>
+    #define SORTNET_SSE41  __attribute__((target("sse4.1")))
+    #define SORTNET_AVX2   __attribute__((target("avx2")))
+    #define SORTNET_AVX512 __attribute__((target("avx512f")))
+#else
+    #define SORTNET_X86 0
+#endif
+
+// ------------------------------------------------------------
+// Runtime ISA detection
+// ------------------------------------------------------------
+enum class SimdLevel { Scalar, SSE41, AVX2, AVX512 };
+
+inline const char* simdLevelName(SimdLevel level)
+{
+    switch (level) {
+        case SimdLevel::AVX512: return "AVX-512";
+        case SimdLevel::AVX2:   return "AVX2";
+        case SimdLevel::SSE41:  return "SSE4.1";
+        default:                return "scalar";
+    }
+}
+
+/*
+    detectSimdLevel()
+    -----------------
+    Best instruction set available on THIS machine (checked once, cached).
+*/
+inline SimdLevel detectSimdLevel()
+{
+#if SORTNET_X86
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2"))    return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.1"))  return SimdLevel::SSE41;
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+/*
+    networkComparators()
+    --------------------
+    Number of compare-exchange steps in the bitonic network used for an
+    n-element leaf (n is padded up to 8, 16 or 32). Used for step counting.
+*/
+inline long long networkComparators(int n)
+{
+    if (n <= 1)  return 0;
+    if (n <= 8)  return 24;
+    if (n <= 16) return 80;
+    return 240;
+}
+
+// ------------------------------------------------------------
+// Scalar bitonic network (fallback and reference)
+// ------------------------------------------------------------
+
+/*
+    sortNetworkScalar()
+    -------------------
+    Classic bitonic sort of a[0..n), n a power of two.
+    Block size k doubles; inside each block the direction alternates so that
+    every pair of neighbouring blocks forms a bitonic sequence.
+*/
+inline void sortNetworkScalar(int* a, int n)
+{
+    for (int k = 2; k <= n; k *= 2) {
+        for (int j = k / 2; j >= 1; j /= 2) {
+            for (int i = 0; i < n; i++) {
+                int partner = i ^ j;
+                if (partner > i) {
+                    bool ascending = (i & k) == 0;
+                    int lo = std::min(a[i], a[partner]);
+                    int hi = std::max(a[i], a[partner]);
+                    a[i]       = ascending ? lo : hi;
+                    a[partner] = ascending ? hi : lo;
+                }
+            }
+        }
+    }
+}
+
+#if SORTNET_X86
+
+// ------------------------------------------------------------
+// Shared helper: which lanes keep the MIN in a compare-exchange
+// ------------------------------------------------------------
+/*
+    For bitonic step (block size K, distance J), lane i keeps the minimum of
+    (v[i], v[i ^ J]) exactly when
+        "i is the lower partner"  ==  "i's block is ascending"
+    i.e.  ((i & J) == 0) == ((i & K) == 0).
+    Returned as a blend immediate: bit i set => lane i takes the min.
+*/
+constexpr int sortnetMinLanes(int j, int k, int lanes)
+{
+    int mask = 0;
+    for (int i = 0; i < lanes; i++) {
+        if (((i & j) == 0) == ((i & k) == 0)) mask |= (1 << i);
+    }
+    return mask;
+}
+
+// ------------------------------------------------------------
+// AVX2: 8 x int32 per register
+// ------------------------------------------------------------
+
+// Lane partner at distance J (lane i <-> lane i ^ J)
+template <int J>
+SORTNET_AVX2 inline __m256i avx2Partner(__m256i v)
+{
+    if constexpr (J == 1)      return _mm256_shuffle_epi32(v, 0xB1);          // 1,0,3,2
+    else if constexpr (J == 2) return _mm256_shuffle_epi32(v, 0x4E);          // 2,3,0,1
+    else                       return _mm256_permute2x128_si256(v, v, 0x01);  // swap halves
+}
+
+// One compare-exchange step inside a register
+template <int J, int K>
+SORTNET_AVX2 inline __m256i avx2Step(__m256i v)
+{
+    constexpr int minLanes = sortnetMinLanes(J, K, 8);
+    __m256i p  = avx2Partner<J>(v);
+    __m256i mn = _mm256_min_epi32(v, p);
+    __m256i mx = _mm256_max_epi32(v, p);
+    return _mm256_blend_epi32(mx, mn, minLanes);
+}
+
+// Full bitonic sort of one register (6 steps)
+SORTNET_AVX2 inline __m256i avx2Sort8(__m256i v)
+{
+    v = avx2Step<1, 2>(v);
+    v = avx2Step<2, 4>(v);
+    v = avx2Step<1, 4>(v);
+    v = avx2Step<4, 8>(v);
+    v = avx2Step<2, 8>(v);
+    v = avx2Step<1, 8>(v);
+    return v;
+}
+
+// Bitonic register -> ascending register (3 steps)
+SORTNET_AVX2 inline __m256i avx2Clean8(__m256i v)
+{
+    v = avx2Step<4, 8>(v);
+    v = avx2Step<2, 8>(v);
+    v = avx2Step<1, 8>(v);
+    return v;
+}
+
+SORTNET_AVX2 inline __m256i avx2Reverse8(__m256i v)
+{
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+/*
+    avx2CleanRegs()
+    ---------------
+    r[0..count) holds a bitonic sequence of count*8 ints. Half-cleaners
+    across registers (plain lane-wise min/max), then inside each register.
+*/
+SORTNET_AVX2 inline void avx2CleanRegs(__m256i* r, int count)
+{
+    for (int d = count / 2; d >= 1; d /= 2) {
+        for (int i = 0; i < count; i++) {
+            if ((i & d) == 0) {
+                __m256i lo = _mm256_min_epi32(r[i], r[i + d]);
+                __m256i hi = _mm256_max_epi32(r[i], r[i + d]);
+                r[i] = lo;
+                r[i + d] = hi;
+            }
+        }
+    }
+    for (int i = 0; i < count; i++) r[i] = avx2Clean8(r[i]);
+}
+
+/*
+    avx2MergeRegs()
+    ---------------
+    Bitonic merge of two sorted register runs r[0..h) and r[h..count):
+    reverse the second run (register order AND lanes), then clean.
+*/
+SORTNET_AVX2 inline void avx2MergeRegs(__m256i* r, int count)
+{
+    int h = count / 2;
+    for (int i = 0; i < h / 2; i++) {
+        __m256i t = r[h + i];
+        r[h + i] = r[count - 1 - i];
+        r[count - 1 - i] = t;
+    }
+    for (int i = h; i < count; i++) r[i] = avx2Reverse8(r[i]);
+    avx2CleanRegs(r, count);
+}
+
+SORTNET_AVX2 inline void avx2SortRegs(__m256i* r, int count)
+{
+    if (count == 1) {
+        r[0] = avx2Sort8(r[0]);
+        return;
+    }
+    avx2SortRegs(r, count / 2);
+    avx2SortRegs(r + count / 2, count / 2);
+    avx2MergeRegs(r, count);
+}
+
+// n in {8, 16, 32}
+SORTNET_AVX2 inline void sortNetworkAVX2(int* a, int n)
+{
+    __m256i r[4];
+    int count = n / 8;
+    for (int i = 0; i < count; i++) r[i] = _mm256_loadu_si256((const __m256i*)(a + 8 * i));
+    avx2SortRegs(r, count);
+    for (int i = 0; i < count; i++) _mm256_storeu_si256((__m256i*)(a + 8 * i), r[i]);
+}
+
+// ------------------------------------------------------------
+// SSE4.1: 4 x int32 per register (same network, narrower lanes)
+// ------------------------------------------------------------
+
+template <int J>
+SORTNET_SSE41 inline __m128i sse41Partner(__m128i v)
+{
+    if constexpr (J == 1) return _mm_shuffle_epi32(v, 0xB1);  // 1,0,3,2
+    else                  return _mm_shuffle_epi32(v, 0x4E);  // 2,3,0,1
+}
+
+template <int J, int K>
+SORTNET_SSE41 inline __m128i sse41Step(__m128i v)
+{
+    constexpr int minLanes = sortnetMinLanes(J, K, 4);
+    __m128i p  = sse41Partner<J>(v);
+    __m128i mn = _mm_min_epi32(v, p);
+    __m128i mx = _mm_max_epi32(v, p);
+    return _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(mx), _mm_castsi128_ps(mn), minLanes));
+}
+
+SORTNET_SSE41 inline __m128i sse41Sort4(__m128i v)
+{
+    v = sse41Step<1, 2>(v);
+    v = sse41Step<2, 4>(v);
+    v = sse41Step<1, 4>(v);
+    return v;
+}
+
+SORTNET_SSE41 inline __m128i sse41Clean4(__m128i v)
+{
+    v = sse41Step<2, 4>(v);
+    v = sse41Step<1, 4>(v);
+    return v;
+}
+
+SORTNET_SSE41 inline void sse41CleanRegs(__m128i* r, int count)
+{
+    for (int d = count / 2; d >= 1; d /= 2) {
+        for (int i = 0; i < count; i++) {
+            if ((i & d) == 0) {
+                __m128i lo = _mm_min_epi32(r[i], r[i + d]);
+                __m128i hi = _mm_max_epi32(r[i], r[i + d]);
+                r[i] = lo;
+                r[i + d] = hi;
+            }
+        }
+    }
+    for (int i = 0; i < count; i++) r[i] = sse41Clean4(r[i]);
+}
+
+SORTNET_SSE41 inline void sse41MergeRegs(__m128i* r, int count)
+{
+    int h = count / 2;
+    for (int i = 0; i < h / 2; i++) {
+        __m128i t = r[h + i];
+        r[h + i] = r[count - 1 - i];
+        r[count - 1 - i] = t;
+    }
+    for (int i = h; i < count; i++) r[i] = _mm_shuffle_epi32(r[i], 0x1B);  // reverse lanes
+    sse41CleanRegs(r, count);
+}
+
+SORTNET_SSE41 inline void sse41SortRegs(__m128i* r, int count)
+{
+    if (count == 1) {
+        r[0] = sse41Sort4(r[0]);
+        return;
+    }
+    sse41SortRegs(r, count / 2);
+    sse41SortRegs(r + count / 2, count / 2);
+    sse41MergeRegs(r, count);
+}
+
+// n in {8, 16, 32}
+SORTNET_SSE41 inline void sortNetworkSSE41(int* a, int n)
+{
+    __m128i r[8];
+    int count = n / 4;
+    for (int i = 0; i < count; i++) r[i] = _mm_loadu_si128((const __m128i*)(a + 4 * i));
+    sse41SortRegs(r, count);
+    for (int i = 0; i < count; i++) _mm_storeu_si128((__m128i*)(a + 4 * i), r[i]);
+}
+
+#endif // SORTNET_X86
+
+// ------------------------------------------------------------
+// Public entry points (runtime dispatch)
+// ------------------------------------------------------------
+
+/*
+    sortNetwork()
+    -------------
+    Sorts exactly n ints (n = 8, 16 or 32) with the given kernel.
+*/
+inline void sortNetwork(int* a, int n, SimdLevel level = detectSimdLevel())
+{
+#if SORTNET_X86
+    if (level >= SimdLevel::AVX2)  { sortNetworkAVX2(a, n);  return; }
+    if (level == SimdLevel::SSE41) { sortNetworkSSE41(a, n); return; }
+#endif
+    (void)level;
+    sortNetworkScalar(a, n);
+}
+
+/*
+    sortSmall()
+    -----------
+    Leaf-case sort for any 0 <= n <= 32.
+
+    The values are copied into a buffer padded to 8/16/32 with INT_MAX
+    sentinels (they sort to the end), sorted by the network, and the first
+    n values are copied back.
+*/
+inline void sortSmall(int* a, int n, SimdLevel level = detectSimdLevel())
+{
+    if (n <= 1) return;
+
+    int size = n <= 8 ? 8 : (n <= 16 ? 16 : 32);
+    int buf[32];
+    for (int i = 0; i < n; i++)    buf[i] = a[i];
+    for (int i = n; i < size; i++) buf[i] = INT_MAX;
+
+    sortNetwork(buf, size, level);
+
+    for (int i = 0; i < n; i++) a[i] = buf[i];
+}
+
+#endif // SECTION12_SORTING_NETWORKS_HPP
@@ -49,6 +49,37 @@
     If the input is already sorted (or nearly sorted), this can degrade to
     worst-case O(n^2). That’s OK for teaching, but in production you’d
     typically choose a better pivot strategy (random pivot, median-of-three, etc.).
+
+    OPTIONAL LEAF KERNEL
+    --------------------
+    quickSort(arr, true) stops recursing once a range has at most NETWORK_LEAF
+    elements and finishes it with a branch-free sorting network
+    (../common/sorting_networks.hpp, AVX2 / SSE4.1 / scalar chosen at runtime).
+    A leaf is counted as the network's comparators plus one write per element.
+
+    OPTIONAL VECTORIZED PARTITION
+    -----------------------------
+    The partition loop itself can be vectorized. Instead of one compare per
+    iteration, PartitionStrategy::AVX2 / AVX512 compare 8 / 16 values against
+    a broadcast pivot at once and COMPRESS them:
+
+      - values <= pivot are packed to the left, written back in place
+      - values >  pivot are packed into a scratch buffer, copied back after
+
+    AVX2 has no compress instruction, so a 256-entry permutation lookup table
+    (one entry per 8-bit compare mask) moves the selected lanes to the front.
+    AVX-512 has vpcompressd, which does the same thing in one instruction.
+
+    PartitionStrategy::Auto picks the widest one the CPU supports (CPUID at
+    runtime); asking for an unsupported one falls back to the next narrower.
+
+    SELECTION
+    ---------
+    nthElement(arr, k) and partialSort(arr, k) find the k-th smallest value /
+    the k smallest values without sorting everything (introselect:
+    median-of-three quickselect on a three-way partition3(), with a
+    median-of-medians fallback). partialSort then sorts only the prefix
+    with gsort::quickSort (median of three + three-way partition).
 */
 
 #include <iostream>
@@ -57,6 +88,12 @@
 #include <string>
 #include <cstdlib>
 #include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "../common/sorting_networks.hpp"
+#include "../common/fast_loader.hpp"
+#include "../common/generic_sort.hpp"  // scalar partitions + insertion sort
 
 using std::cout;
 using std::endl;
@@ -69,6 +106,61 @@ using std::vector;
 // These are reset by quickSort() for each run.
 static long long g_comparisons = 0;  // counts comparisons: arr[j] <= pivot
 static long long g_writes      = 0;  // counts "writes" (data movement), swap=3 writes
+static long long g_leafKernels = 0;  // counts ranges finished by a sorting network
+
+// gsort stats policy that counts into the globals above
+struct GlobalCounters {
+    void compare() { g_comparisons++; }
+    void write(long long n = 1) { g_writes += n; }
+    void swap() { g_writes += 3; }
+};
+
+// Largest range handed to the sorting-network leaf kernel
+static const int NETWORK_LEAF = 32;
+
+// ------------------------------------------------------------
+// PARTITION STRATEGIES
+// ------------------------------------------------------------
+enum class PartitionStrategy { Lomuto, AVX2, AVX512, Auto };
+
+static const char* partitionStrategyName(PartitionStrategy strategy) {
+    switch (strategy) {
+        case PartitionStrategy::AVX2:   return "AVX2";
+        case PartitionStrategy::AVX512: return "AVX-512";
+        case PartitionStrategy::Auto:   return "auto";
+        default:                        return "Lomuto";
+    }
+}
+
+/*
+    resolveStrategy()
+    -----------------
+    Maps a requested strategy to one this CPU can actually run:
+      - Auto   -> widest supported
+      - AVX512 -> AVX2 -> Lomuto, stepping down until supported
+*/
+static PartitionStrategy resolveStrategy(PartitionStrategy requested) {
+    SimdLevel level = detectSimdLevel();
+
+    if (requested == PartitionStrategy::Auto) requested = PartitionStrategy::AVX512;
+    if (requested == PartitionStrategy::AVX512 && level < SimdLevel::AVX512) requested = PartitionStrategy::AVX2;
+    if (requested == PartitionStrategy::AVX2 && level < SimdLevel::AVX2) requested = PartitionStrategy::Lomuto;
+
+    return requested;
+}
+
+/*
+    QuickSortConfig
+    ---------------
+    Options shared by every recursive call of one quickSort() run.
+    `scratch` holds the "> pivot" side during a vectorized partition; it is
+    allocated once per sort (n + 16 ints, room for one overhanging store).
+*/
+struct QuickSortConfig {
+    bool useNetworkLeaves = false;
+    PartitionStrategy strategy = PartitionStrategy::Lomuto;  // never Auto here
+    vector<int> scratch;
+};
 
 // ------------------------------------------------------------
 // Quick Sort (Lomuto partition) with step counting
@@ -99,35 +191,169 @@ static long long g_writes      = 0;  // counts "writes" (data movement), swap=3
       - g_writes += 3 for each swap (teaching approximation)
 */
 static int partition(vector<int>& arr, int left, int right) {
-    // Pivot selection: last element in the current partition
-    int pivot = arr[right];
+    // gsort::lomutoPartition (../common/generic_sort.hpp) runs the loop
+    // above with std::less, so "arr[j] <= pivot" is !(pivot < arr[j])
+    GlobalCounters counters;
+    auto pivotPos = gsort::lomutoPartition(arr.begin() + left, arr.begin() + right,
+                                           std::less<>(), counters);
+
+    // pivotPos is the pivot's final position
+    return static_cast<int>(pivotPos - arr.begin());
+}
 
-    // i marks the boundary between <= pivot and > pivot regions
-    int i = left;
+// ------------------------------------------------------------
+// Vectorized partitions (same pivot choice as partition())
+// ------------------------------------------------------------
+/*
+    STEP COUNTING (vector partitions)
+    ---------------------------------
+      - g_comparisons += 1 per element compared with the pivot (a vector
+        compare of 8 lanes counts as 8), so the totals line up with Lomuto
+      - g_writes += 1 per element stored (left side or scratch), +1 for the
+        pivot, +1 per element copied back from scratch. There are no swaps.
+*/
+
+/*
+    finishPartition()
+    -----------------
+    Scalar tail + final placement shared by both vector versions.
 
-    // Scan all elements except the pivot itself
-    for (int j = left; j < right; ++j) {
-        g_comparisons++; // compare arr[j] <= pivot
+    On entry arr[left .. store) holds values <= pivot, scratch[0 .. hiCount)
+    holds values > pivot, and arr[j .. right) is still unread.
+*/
+static int finishPartition(vector<int>& arr, int j, int right, int store,
+                           int* hi, int hiCount, int pivot) {
+    for (; j < right; ++j) {
+        g_comparisons++;
+        if (arr[j] <= pivot) arr[store++] = arr[j];
+        else                 hi[hiCount++] = arr[j];
+        g_writes++;
+    }
 
-        // If current element belongs in the "small" (<= pivot) side
-        if (arr[j] <= pivot) {
-            // Swap arr[i] with arr[j] to grow the <= pivot region
-            std::swap(arr[i], arr[j]);
+    // Pivot goes right after the small side, large side after the pivot
+    arr[store] = pivot;
+    std::copy(hi, hi + hiCount, arr.begin() + store + 1);
+    g_writes += 1 + hiCount;
 
-            // Count the cost of swapping values (approx as 3 writes)
-            g_writes += 3;
+    return store;
+}
 
-            // Move boundary forward
-            ++i;
+#if SORTNET_X86
+
+/*
+    compressLUT()
+    -------------
+    compressLUT()[m] is a lane permutation that moves the lanes whose bit is
+    set in the 8-bit mask m to the front (in order). Built once on first use.
+*/
+static const int (*compressLUT())[8] {
+    alignas(32) static int lut[256][8];
+    static bool built = false;
+
+    if (!built) {
+        for (int m = 0; m < 256; ++m) {
+            int k = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if (m & (1 << lane)) lut[m][k++] = lane;
+            }
+            for (int lane = 0; lane < 8; ++lane) {
+                if (!(m & (1 << lane))) lut[m][k++] = lane;
+            }
         }
+        built = true;
     }
+    return lut;
+}
 
-    // Put pivot in its final sorted position
-    std::swap(arr[i], arr[right]);
-    g_writes += 3;
+/*
+    partitionAVX2()
+    ---------------
+    8 values per iteration:
+        mask = movemask(v > pivot)
+        left  lanes (<= pivot): permute by lut[~mask], store at arr[store]
+        right lanes (>  pivot): permute by lut[mask],  store at scratch[hiCount]
+
+    Each store writes all 8 lanes but only popcount(...) of them are kept;
+    the next store overwrites the rest. Writing arr[store .. store+8) in place
+    is safe because store <= j: those slots have already been loaded.
+*/
+SORTNET_AVX2 static int partitionAVX2(vector<int>& arr, int left, int right, vector<int>& scratch) {
+    const int (*lut)[8] = compressLUT();
+    int pivot = arr[right];
+    const __m256i pv = _mm256_set1_epi32(pivot);
+
+    int* a  = arr.data();
+    int* hi = scratch.data();
+    int store = left;
+    int hiCount = 0;
+    int j = left;
+
+    for (; j + 8 <= right; j += 8) {
+        __m256i v  = _mm256_loadu_si256((const __m256i*)(a + j));
+        int gtMask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pv)));
+        int leMask = ~gtMask & 0xFF;
+
+        __m256i le = _mm256_permutevar8x32_epi32(v, _mm256_load_si256((const __m256i*)lut[leMask]));
+        __m256i gt = _mm256_permutevar8x32_epi32(v, _mm256_load_si256((const __m256i*)lut[gtMask]));
+        _mm256_storeu_si256((__m256i*)(a + store), le);
+        _mm256_storeu_si256((__m256i*)(hi + hiCount), gt);
+
+        int leCount = __builtin_popcount(leMask);
+        store   += leCount;
+        hiCount += 8 - leCount;
+        g_comparisons += 8;
+        g_writes += 8;
+    }
 
-    // i is now the pivot's index
-    return i;
+    return finishPartition(arr, j, right, store, hi, hiCount, pivot);
+}
+
+/*
+    partitionAVX512()
+    -----------------
+    16 values per iteration; vpcompressd stores exactly the selected lanes,
+    so no lookup table is needed.
+*/
+SORTNET_AVX512 static int partitionAVX512(vector<int>& arr, int left, int right, vector<int>& scratch) {
+    int pivot = arr[right];
+    const __m512i pv = _mm512_set1_epi32(pivot);
+
+    int* a  = arr.data();
+    int* hi = scratch.data();
+    int store = left;
+    int hiCount = 0;
+    int j = left;
+
+    for (; j + 16 <= right; j += 16) {
+        __m512i v = _mm512_loadu_si512((const void*)(a + j));
+        __mmask16 le = _mm512_cmple_epi32_mask(v, pv);
+
+        _mm512_mask_compressstoreu_epi32((void*)(a + store), le, v);
+        _mm512_mask_compressstoreu_epi32((void*)(hi + hiCount), (__mmask16)~le, v);
+
+        int leCount = __builtin_popcount((unsigned)le);
+        store   += leCount;
+        hiCount += 16 - leCount;
+        g_comparisons += 16;
+        g_writes += 16;
+    }
+
+    return finishPartition(arr, j, right, store, hi, hiCount, pivot);
+}
+
+#endif // SORTNET_X86
+
+/*
+    partitionRange()
+    ----------------
+    Calls the partition selected in cfg (already resolved for this CPU).
+*/
+static int partitionRange(vector<int>& arr, int left, int right, QuickSortConfig& cfg) {
+#if SORTNET_X86
+    if (cfg.strategy == PartitionStrategy::AVX512) return partitionAVX512(arr, left, right, cfg.scratch);
+    if (cfg.strategy == PartitionStrategy::AVX2)   return partitionAVX2(arr, left, right, cfg.scratch);
+#endif
+    return partition(arr, left, right);
 }
 
 /*
@@ -137,19 +363,32 @@ static int partition(vector<int>& arr, int left, int right) {
 
     Base case:
       - if left >= right, the range has 0 or 1 element, so it is already sorted.
+      - if useNetworkLeaves and the range has at most NETWORK_LEAF elements,
+        a sorting network finishes it in one branch-free call.
 
     Recursive case:
       1) partition arr[left..right] around pivot -> get pivot index p
       2) sort left side:  arr[left..p-1]
       3) sort right side: arr[p+1..right]
 */
-static void quickSortRec(vector<int>& arr, int left, int right) {
+static void quickSortRec(vector<int>& arr, int left, int right, QuickSortConfig& cfg) {
+    if (cfg.useNetworkLeaves && right - left + 1 <= NETWORK_LEAF) {
+        int n = right - left + 1;
+        if (n > 1) {
+            sortSmall(&arr[left], n);
+            g_comparisons += networkComparators(n);
+            g_writes += n;
+            g_leafKernels++;
+        }
+        return;
+    }
+
     if (left < right) {
-        int p = partition(arr, left, right);
+        int p = partitionRange(arr, left, right, cfg);
 
         // Recursively sort the partitions around the pivot
-        quickSortRec(arr, left, p - 1);
-        quickSortRec(arr, p + 1, right);
+        quickSortRec(arr, left, p - 1, cfg);
+        quickSortRec(arr, p + 1, right, cfg);
     }
 }
 
@@ -159,16 +398,236 @@ static void quickSortRec(vector<int>& arr, int left, int right) {
     Public wrapper:
       - resets step counters
       - sorts the entire vector if it is not empty
+      - useNetworkLeaves = true finishes small ranges with a sorting network
+      - strategy selects the partition loop (Lomuto, AVX2, AVX512, Auto)
 */
-void quickSort(vector<int>& arr) {
+void quickSort(vector<int>& arr, bool useNetworkLeaves = false,
+               PartitionStrategy strategy = PartitionStrategy::Lomuto) {
     g_comparisons = 0;
     g_writes = 0;
+    g_leafKernels = 0;
+
+    QuickSortConfig cfg;
+    cfg.useNetworkLeaves = useNetworkLeaves;
+    cfg.strategy = resolveStrategy(strategy);
+    if (cfg.strategy != PartitionStrategy::Lomuto) {
+        cfg.scratch.resize(arr.size() + 16);
+    }
 
     if (!arr.empty()) {
-        quickSortRec(arr, 0, static_cast<int>(arr.size()) - 1);
+        quickSortRec(arr, 0, static_cast<int>(arr.size()) - 1, cfg);
     }
 }
 
+// ------------------------------------------------------------
+// SELECTION: nthElement() and partialSort()
+// ------------------------------------------------------------
+/*
+    When only the k-th smallest value (e.g. the median) or the k smallest
+    values are needed, a full sort is wasted work. Quick sort's partition()
+    already puts the pivot in its FINAL sorted position p, so:
+
+        k == p  -> done
+        k <  p  -> only the left part [left, p-1] can contain it
+        k >  p  -> only the right part [p+1, right]
+
+    Recursing into ONE side instead of both is QUICKSELECT: about 2n-3n
+    comparisons on average instead of ~1.4 n log2 n.
+
+    THREE-WAY PARTITION
+    -------------------
+    partition() sends every key EQUAL to the pivot to the left side. On an
+    all-equal array each round then removes one element: O(n^2) even with
+    perfect pivots. Selection therefore uses partition3() (three-way
+    partition), which splits the range into  < pivot | == pivot | > pivot.
+    If k lands in the == block the answer is found; otherwise only the <
+    or > part is kept, so duplicates of the pivot never come back.
+
+    INTROSELECT
+    -----------
+    Quickselect with a bad pivot is O(n^2), just like quick sort. We:
+      1) pick the pivot as the median of arr[left], arr[mid], arr[right]
+      2) allow ~2 log2(n) partition rounds; if the range is still not
+         resolved, switch to MEDIAN OF MEDIANS, which guarantees a pivot
+         between the 30th and 70th percentile -> O(n) worst case, with or
+         without duplicates (at least 30% of the range is <= the pivot and
+         at least 30% is >=, so the < and > parts each hold at most 70%)
+
+    MEDIAN OF MEDIANS
+    -----------------
+      - split the range into groups of 5 and insertion-sort each group
+      - move each group's median to the front of the range
+      - recursively SELECT the median of those medians -> pivot
+    Guaranteed linear, but with a much larger constant than median-of-three,
+    which is why it is only the fallback.
+
+    partialSort(arr, k) = select the k-th smallest (so the k smallest values
+    are in arr[0..k-1]), then quick sort only that prefix. The prefix is
+    sorted with gsort::quickSort, NOT quickSortRec(): a last-element pivot
+    would be O(k^2) on a sorted or all-equal prefix.
+
+    Counting: the same g_comparisons / g_writes model as quickSort().
+    g_momFallbacks counts how often introselect had to switch strategies.
+*/
+static long long g_momFallbacks = 0;  // introselect -> median-of-medians switches
+
+// Swaps two elements and counts it as 3 writes, like partition()
+static void swapCounted(vector<int>& arr, int a, int b) {
+    std::swap(arr[a], arr[b]);
+    g_writes += 3;
+}
+
+// Insertion sort on arr[left..right] (used for the groups of 5)
+static void insertionSortRange(vector<int>& arr, int left, int right) {
+    GlobalCounters counters;
+    gsort::insertionSort(arr.begin() + left, arr.begin() + right + 1, std::less<>(), counters);
+}
+
+/*
+    partition3()
+    ------------
+    Three-way partition of arr[left..right] around the VALUE pivot.
+    Afterwards:
+
+        arr[left .. lt-1]   <  pivot
+        arr[lt   .. gt]     == pivot
+        arr[gt+1 .. right]  >  pivot
+
+    One Hoare-style pass from both ends; keys equal to the pivot are parked
+    at the two ends and swapped into the middle afterwards (Bentley-McIlroy,
+    see gsort::partition3). Counting: 1-2 comparisons per element, swaps as
+    3 writes.
+*/
+static void partition3(vector<int>& arr, int left, int right, int pivot, int& lt, int& gt) {
+    // gsort::partition3 works on [first, last) and returns the == range
+    // half-open; convert to the inclusive indices used here
+    GlobalCounters counters;
+    auto eq = gsort::partition3(arr.begin() + left, arr.begin() + right + 1, pivot,
+                                std::less<>(), counters);
+    lt = static_cast<int>(eq.first - arr.begin());
+    gt = static_cast<int>(eq.second - arr.begin()) - 1;
+}
+
+static void selectMedianOfMedians(vector<int>& arr, int left, int right, int k);
+
+/*
+    medianOfMedians()
+    -----------------
+    Returns the index of a pivot within arr[left..right] that has at least
+    ~30% of the range on each side. Reorders the range while doing so.
+*/
+static int medianOfMedians(vector<int>& arr, int left, int right) {
+    if (right - left < 5) {
+        insertionSortRange(arr, left, right);
+        return left + (right - left) / 2;
+    }
+
+    // Median of each group of 5 -> packed at the front of the range
+    int store = left;
+    for (int g = left; g <= right; g += 5) {
+        int gEnd = std::min(g + 4, right);
+        insertionSortRange(arr, g, gEnd);
+        swapCounted(arr, store, g + (gEnd - g) / 2);
+        ++store;
+    }
+
+    // The median of those medians is the pivot
+    int mid = left + (store - 1 - left) / 2;
+    selectMedianOfMedians(arr, left, store - 1, mid);
+    return mid;
+}
+
+/*
+    selectMedianOfMedians()
+    -----------------------
+    Deterministic linear-time selection: places the k-th smallest value of
+    arr[left..right] at index k, using only median-of-medians pivots.
+*/
+static void selectMedianOfMedians(vector<int>& arr, int left, int right, int k) {
+    while (left < right) {
+        int pivot = arr[medianOfMedians(arr, left, right)];
+
+        int lt, gt;
+        partition3(arr, left, right, pivot, lt, gt);
+        if (k >= lt && k <= gt) return;   // k is inside the == block
+        if (k < lt) right = lt - 1;
+        else        left = gt + 1;
+    }
+}
+
+/*
+    introSelect()
+    -------------
+    Median-of-three quickselect with a partition budget; falls back to
+    selectMedianOfMedians() when the budget runs out.
+*/
+static void introSelect(vector<int>& arr, int left, int right, int k) {
+    int budget = 0;
+    for (int n = right - left + 1; n > 1; n >>= 1) budget += 2;  // ~2 log2(n)
+
+    while (left < right) {
+        if (budget-- == 0) {
+            g_momFallbacks++;
+            selectMedianOfMedians(arr, left, right, k);
+            return;
+        }
+
+        // Median of three -> arr[right], then a three-way partition
+        int mid = left + (right - left) / 2;
+        g_comparisons += 3;
+        if (arr[mid] < arr[left])  swapCounted(arr, mid, left);
+        if (arr[right] < arr[left]) swapCounted(arr, right, left);
+        if (arr[mid] < arr[right]) swapCounted(arr, mid, right);
+
+        int lt, gt;
+        partition3(arr, left, right, arr[right], lt, gt);
+        if (k >= lt && k <= gt) return;   // k is inside the == block
+        if (k < lt) right = lt - 1;
+        else        left = gt + 1;
+    }
+}
+
+/*
+    nthElement()
+    ------------
+    Like std::nth_element: afterwards arr[k] is the value that would be at
+    index k in sorted order, everything before it is <= arr[k] and
+    everything after it is >= arr[k]. Resets the step counters.
+*/
+void nthElement(vector<int>& arr, int k) {
+    g_comparisons = 0;
+    g_writes = 0;
+    g_momFallbacks = 0;
+
+    if (k < 0 || k >= static_cast<int>(arr.size())) return;
+    introSelect(arr, 0, static_cast<int>(arr.size()) - 1, k);
+}
+
+/*
+    partialSort()
+    -------------
+    Like std::partial_sort: afterwards arr[0..k-1] holds the k smallest
+    values in ascending order; the rest is in unspecified order.
+    Resets the step counters.
+*/
+void partialSort(vector<int>& arr, int k) {
+    g_comparisons = 0;
+    g_writes = 0;
+    g_momFallbacks = 0;
+
+    int n = static_cast<int>(arr.size());
+    k = std::min(k, n);
+    if (k <= 0) return;
+
+    // k smallest -> arr[0..k-1] (only needed if something is left over)
+    if (k < n) introSelect(arr, 0, n - 1, k - 1);
+
+    // Sort just the prefix: median of three + three-way partition, so a
+    // sorted or all-equal prefix stays O(k log k)
+    GlobalCounters counters;
+    gsort::quickSort(arr.begin(), arr.begin() + k, std::less<>(), counters);
+}
+
 // ------------------------------------------------------------
 // FILE LOADER (tries several relative paths)
 // ------------------------------------------------------------
@@ -231,16 +690,65 @@ vector<int> loadFile(const string& filename) {
         std::exit(1);
     }
 
-    // Read ints until EOF
+    // Read ints until EOF (bulk parser, ../common/fast_loader.hpp)
+    in.close();
     vector<int> arr;
-    int x;
-    while (in >> x) {
-        arr.push_back(x);
-    }
+    loadIntsFast(full, arr);
 
     return arr;
 }
 
+// ------------------------------------------------------------
+// TIMING HELPER
+// ------------------------------------------------------------
+/*
+    averageSortMicros()
+    -------------------
+    Sorts a fresh copy of `input` `reps` times and returns the average
+    wall-clock time per sort in microseconds (copying is not timed).
+*/
+static double averageSortMicros(const vector<int>& input, bool useNetworkLeaves,
+                                PartitionStrategy strategy = PartitionStrategy::Lomuto,
+                                int reps = 50) {
+    double total = 0.0;
+    for (int r = 0; r < reps; ++r) {
+        vector<int> arr = input;
+        auto start = std::chrono::steady_clock::now();
+        quickSort(arr, useNetworkLeaves, strategy);
+        auto stop = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::micro>(stop - start).count();
+    }
+    return total / reps;
+}
+
+// ------------------------------------------------------------
+// SELECTION CHECKS
+// ------------------------------------------------------------
+/*
+    isSelected()
+    ------------
+    True if arr[k] == expected[k] and arr is partitioned around it.
+*/
+static bool isSelected(const vector<int>& arr, const vector<int>& expected, int k) {
+    if (arr[k] != expected[k]) return false;
+    for (int i = 0; i < k; ++i) {
+        if (arr[i] > arr[k]) return false;
+    }
+    for (size_t i = k + 1; i < arr.size(); ++i) {
+        if (arr[i] < arr[k]) return false;
+    }
+    return true;
+}
+
+static void printSelectionRow(const string& name, bool ok) {
+    cout << "  " << name;
+    for (size_t pad = name.size(); pad < 30; ++pad) cout << ' ';
+    cout << "comparisons " << g_comparisons
+         << ", writes " << g_writes
+         << ", MoM fallbacks " << g_momFallbacks
+         << (ok ? "  \xE2\x9C\x94" : "  \xE2\x9D\x8B") << "\n";
+}
+
 // ------------------------------------------------------------
 // MAIN TEST
 // ------------------------------------------------------------
@@ -253,7 +761,12 @@ vector<int> loadFile(const string& filename) {
     4) Sort with quickSort()
     5) Verify sorted output equals ordered.txt
     6) Print step counts and a small output sample
+    7) Repeat with sorting-network leaves and compare average run times
+    8) Run every partition strategy and check each against ordered.txt
+    9) Compare nthElement() / partialSort() with a full sort, then
+       select on all-equal and 4-distinct-value inputs
 */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // Load data
     vector<int> unordered = loadFile("unordered.txt");
@@ -300,5 +813,118 @@ int main() {
         cout << "\n";
     }
 
+    // Same input again, finishing small ranges with a sorting network
+    vector<int> leafArr = unordered;
+    quickSort(leafArr, true);
+    bool leafOk = (leafArr == expected);
+
+    cout << "\nQuick Sort + network leaves (" << simdLevelName(detectSimdLevel()) << ")\n";
+    cout << "----------------------------------\n";
+    cout << "Leaf kernels: " << g_leafKernels << "\n";
+    cout << "Comparisons:  " << g_comparisons << "\n";
+    cout << "Writes:       " << g_writes << "\n";
+    cout << "Correct?      " << (leafOk ? "YES \xE2\x9C\x94" : "NO \xE2\x9D\x8B") << "\n";
+
+    cout << "\nAverage time per sort (50 runs):\n";
+    cout << "  plain:          " << averageSortMicros(unordered, false) << " us\n";
+    cout << "  network leaves: " << averageSortMicros(unordered, true) << " us\n";
+
+    // Every partition strategy on the same input, verified against ordered.txt
+    cout << "\nPartition strategies (CPU: " << simdLevelName(detectSimdLevel()) << ")\n";
+    cout << "----------------------------------\n";
+
+    const PartitionStrategy strategies[] = {
+        PartitionStrategy::Lomuto, PartitionStrategy::AVX2,
+        PartitionStrategy::AVX512, PartitionStrategy::Auto
+    };
+
+    for (PartitionStrategy strategy : strategies) {
+        vector<int> work = unordered;
+        quickSort(work, false, strategy);
+        bool strategyOk = (work == expected);
+
+        cout << partitionStrategyName(strategy);
+        if (resolveStrategy(strategy) != strategy) {
+            cout << " -> " << partitionStrategyName(resolveStrategy(strategy));
+        }
+        cout << ":\n";
+        cout << "  Comparisons:  " << g_comparisons << "\n";
+        cout << "  Writes:       " << g_writes << "\n";
+        cout << "  Avg time:     " << averageSortMicros(unordered, false, strategy) << " us\n";
+        cout << "  Correct?      " << (strategyOk ? "YES \xE2\x9C\x94" : "NO \xE2\x9D\x8B") << "\n";
+    }
+
+    // Selection vs a full sort on the same input
+    int n = static_cast<int>(unordered.size());
+    int median = n / 2;
+    int topK = std::min(1000, n);
+
+    cout << "\nSelection vs full sort (n = " << n << ")\n";
+    cout << "----------------------------------\n";
+
+    vector<int> work = unordered;
+    quickSort(work);
+    g_momFallbacks = 0;
+    printSelectionRow("quickSort (full)", work == expected);
+
+    work = unordered;
+    nthElement(work, median);
+    printSelectionRow("nthElement(median)", isSelected(work, expected, median));
+
+    work = expected;
+    nthElement(work, median);
+    printSelectionRow("nthElement(median), sorted", isSelected(work, expected, median));
+
+    work = unordered;
+    partialSort(work, topK);
+    printSelectionRow("partialSort(k = " + std::to_string(topK) + ")",
+                      std::equal(expected.begin(), expected.begin() + topK, work.begin()));
+
+    work = expected;
+    partialSort(work, n / 2);
+    printSelectionRow("partialSort(k = n/2), sorted", work == expected);
+
+    // Median of medians on its own: linear, but a larger constant
+    work = unordered;
+    g_comparisons = 0;
+    g_writes = 0;
+    g_momFallbacks = 0;
+    selectMedianOfMedians(work, 0, n - 1, median);
+    printSelectionRow("median of medians only", isSelected(work, expected, median));
+
+    // Duplicate-heavy input: all equal, and only 4 distinct values
+    vector<int> allEqual(n, 42);
+    vector<int> fourValues(n);
+    for (int i = 0; i < n; ++i) fourValues[i] = ((unordered[i] % 4) + 4) % 4;
+    vector<int> fourSorted = fourValues;
+    std::sort(fourSorted.begin(), fourSorted.end());
+
+    work = allEqual;
+    nthElement(work, median);
+    printSelectionRow("nthElement(median), all equal", isSelected(work, allEqual, median));
+
+    work = fourValues;
+    nthElement(work, median);
+    printSelectionRow("nthElement(median), 4 values", isSelected(work, fourSorted, median));
+
+    work = allEqual;
+    g_comparisons = 0;
+    g_writes = 0;
+    g_momFallbacks = 0;
+    selectMedianOfMedians(work, 0, n - 1, median);
+    printSelectionRow("median of medians, all equal", isSelected(work, allEqual, median));
+
+    work = fourValues;
+    g_comparisons = 0;
+    g_writes = 0;
+    g_momFallbacks = 0;
+    selectMedianOfMedians(work, 0, n - 1, median);
+    printSelectionRow("median of medians, 4 values", isSelected(work, fourSorted, median));
+
+    work = allEqual;
+    partialSort(work, n / 2);
+    printSelectionRow("partialSort(k = n/2), all eq", work == allEqual);
+
     return 0;
 }
+#endif // SECTION12_NO_MAIN
@@ -49,6 +49,24 @@
 //   - Extract n times: O(n log n)
 //   - Total: O(n log n) time, O(1) extra space (in-place)
 //
+// OPTIMIZED VARIANTS
+// ------------------
+// heapSortFloyd() - "bottom-up" heapsort (Floyd):
+//   - Moves values through a HOLE instead of swapping: each step down is a
+//     single write (arr[hole] = arr[child]) instead of a 3-write swap.
+//   - After an extraction the value placed at the root came from the bottom
+//     of the heap, so it almost always belongs near the bottom again. Floyd's
+//     trick walks the hole straight down to a leaf (1 comparison per level:
+//     which child is larger) and only then bubbles the value up the few
+//     levels it needs. Total ~n log2 n comparisons instead of ~2 n log2 n.
+//
+// heapSort4ary() - same hole/Floyd idea on a 4-ary heap:
+//   - children of i are 4i+1 .. 4i+4, parent is (i-1)/4
+//   - half as many levels, and the 4 children sit next to each other in
+//     memory (16 bytes), so each level touches one cache line instead of
+//     jumping across the array. Costs 3 comparisons per level to find the
+//     largest child.
+//
 // ============================================================================
 
 #include <iostream>
@@ -56,14 +74,18 @@
 #include <vector>
 #include <string>
 #include <cstdlib>   // std::exit
+#include <functional> // std::less
+
+#include "../common/fast_loader.hpp"
+#include "../common/generic_sort.hpp"  // gsort::heapSort runs the baseline heap sort
 
 using namespace std;
 
 // ---------------------------------------------------------------------------
 // GLOBAL COUNTERS (illustrate complexity)
 // ---------------------------------------------------------------------------
-// We keep these global so that heapify/swap can update them without needing
-// to pass them down through every helper function call.
+// We keep these global so that the counting policy (HeapCounters) and the
+// sift-down helpers can update them without passing them through every call.
 static long long g_comparisons = 0;  // counts data-to-data comparisons
 static long long g_writes      = 0;  // counts array writes (swap counted as 3)
 
@@ -125,14 +147,10 @@ static vector<int> loadFile(const string& filename) {
 
     cout << "Loaded: " << usedPath << "\n";
 
-    // Read all integers from the file
-    vector<int> data;
-    int x;
-    while (in >> x) {
-        data.push_back(x);
-    }
-
+    // Read all integers from the file (bulk parser, ../common/fast_loader.hpp)
     in.close();
+    vector<int> data;
+    loadIntsFast(usedPath, data);
     return data;
 }
 
@@ -140,79 +158,28 @@ static vector<int> loadFile(const string& filename) {
 // Heap sort implementation with step counting
 // ---------------------------------------------------------------------------
 
-// swapInt(a, b)
-// -------------
-// Swaps two integers by reference.
-// Step counting:
-//   - We treat a swap as 3 writes (tmp + a + b), consistent with your other
-//     sorting examples.
-//
-// Note:
-//   - In reality, you could count writes differently (e.g., only assignments
-//     to array indices). Here we keep it consistent across the lesson set.
-static void swapInt(int& a, int& b) {
-    int tmp = a;
-    a = b;
-    b = tmp;
-
-    // Count swap as "3 writes"
-    g_writes += 3;
-}
-
-// heapify(arr, n, i)
-// ------------------
-// Restores the MAX-HEAP property for the subtree rooted at index i within
-// arr[0 .. n-1].
-//
-// MAX-HEAP property:
-//   Every parent node >= its children.
-//
-// How heapify works:
-//   1) Identify the largest value among:
-//        - current node i
-//        - left child  (2*i + 1)
-//        - right child (2*i + 2)
-//   2) If one of the children is larger than arr[i], swap and recurse down.
-//
-// Step counting:
-//   - Each time we compare arr[left] to arr[largest], that's a comparison.
-//   - Each time we compare arr[right] to arr[largest], that's a comparison.
-//   - We do NOT count "left < n" or "right < n" as a comparison.
-static void heapify(vector<int>& arr, int n, int i) {
-    int largest = i;         // assume root is largest initially
-    int left  = 2 * i + 1;   // left child index
-    int right = 2 * i + 2;   // right child index
-
-    // If left child exists, compare it to current largest
-    if (left < n) {
-        g_comparisons++;               // compare arr[left] vs arr[largest]
-        if (arr[left] > arr[largest]) {
-            largest = left;
-        }
-    }
-
-    // If right child exists, compare it to current largest
-    if (right < n) {
-        g_comparisons++;               // compare arr[right] vs arr[largest]
-        if (arr[right] > arr[largest]) {
-            largest = right;
-        }
-    }
-
-    // If the largest isn't the root, swap and keep heapifying downward
-    if (largest != i) {
-        swapInt(arr[i], arr[largest]);
-        heapify(arr, n, largest);
-    }
-}
+// HeapCounters
+// ------------
+// Counting policy for gsort::heapSort (../common/generic_sort.hpp): adds
+// straight into the global counters.
+//   - Each compare of a child against the current largest is a comparison
+//     ("left < n" / "right < n" bounds checks are not).
+//   - A swap is 3 writes (tmp + a + b), consistent with the other examples.
+struct HeapCounters {
+    void compare() { g_comparisons++; }
+    void write(long long n = 1) { g_writes += n; }
+    void swap() { g_writes += 3; }
+};
 
 // heapSort(arr)
 // -------------
-// In-place heap sort using a MAX-HEAP.
+// In-place heap sort using a MAX-HEAP, run by gsort::heapSort.
 //
 // Steps:
 //   1) Build a max-heap from the array
 //      - Start from the last parent node and heapify each node down to 0
+//      - heapify(i): swap arr[i] with its larger child while that child is
+//        larger, following it down (MAX-HEAP property: parent >= children)
 //   2) Repeatedly extract the max element
 //      - Swap root with the last element in the unsorted region
 //      - Reduce heap size by 1
@@ -223,32 +190,175 @@ void heapSort(vector<int>& arr) {
     g_comparisons = 0;
     g_writes = 0;
 
+    HeapCounters counters;
+    gsort::heapSort(arr.begin(), arr.end(), std::less<>(), counters);
+}
+
+// ---------------------------------------------------------------------------
+// Optimized heap sorts (hole-based moves + Floyd's sift-down)
+// ---------------------------------------------------------------------------
+
+// siftDownFloyd(arr, n, i, value)
+// -------------------------------
+// Places `value` into the binary max-heap arr[0 .. n-1] starting from the
+// hole at index i (arr[i]'s old contents are assumed already saved/moved).
+//
+// Phase 1: walk the hole down to a leaf, always pulling up the larger child.
+//          Only one data comparison per level (left vs right child).
+// Phase 2: bubble `value` up from that leaf while its parent is smaller.
+//          Usually only a level or two, because `value` came from the bottom.
+//
+// Step counting:
+//   - each child-vs-child and parent-vs-value comparison is 1 comparison
+//   - each hole move and the final placement is 1 write
+static void siftDownFloyd(vector<int>& arr, int n, int i, int value) {
+    int top = i;
+    int hole = i;
+
+    // Phase 1: down to a leaf
+    int child = 2 * hole + 1;
+    while (child < n) {
+        if (child + 1 < n) {
+            g_comparisons++;                   // compare the two children
+            if (arr[child + 1] > arr[child]) child++;
+        }
+        arr[hole] = arr[child];                // larger child moves up
+        g_writes++;
+        hole = child;
+        child = 2 * hole + 1;
+    }
+
+    // Phase 2: back up to value's place
+    while (hole > top) {
+        int parent = (hole - 1) / 2;
+        g_comparisons++;                       // compare parent vs value
+        if (arr[parent] >= value) break;
+        arr[hole] = arr[parent];               // parent moves back down
+        g_writes++;
+        hole = parent;
+    }
+
+    arr[hole] = value;
+    g_writes++;
+}
+
+// heapSortFloyd(arr)
+// ------------------
+// Heap sort with hole-based moves and Floyd's sift-down, binary heap.
+// Same two phases as heapSort(); counters are reset at the start.
+void heapSortFloyd(vector<int>& arr) {
+    g_comparisons = 0;
+    g_writes = 0;
+
     int n = static_cast<int>(arr.size());
-    if (n <= 1) return; // already sorted (or empty)
+    if (n <= 1) return;
 
-    // 1) Build max-heap
-    // The last parent is at index (n/2 - 1). Leaves start at (n/2).
+    // 1) Build max-heap bottom-up
     for (int i = n / 2 - 1; i >= 0; --i) {
-        heapify(arr, n, i);
+        siftDownFloyd(arr, n, i, arr[i]);
     }
 
-    // 2) Extract elements one by one from heap
+    // 2) Move the max to the end; the displaced last value re-enters at the root
     for (int end = n - 1; end > 0; --end) {
-        // Move current max (root) to the end of the array
-        swapInt(arr[0], arr[end]);
+        int value = arr[end];
+        arr[end] = arr[0];
+        g_writes++;
+        siftDownFloyd(arr, end, 0, value);
+    }
+}
+
+// siftDown4ary(arr, n, i, value)
+// ------------------------------
+// Floyd's sift-down on a 4-ary max-heap: children of k are 4k+1 .. 4k+4.
+// Finding the largest of up to 4 children costs up to 3 comparisons per
+// level, but there are only log4(n) = log2(n)/2 levels and the siblings are
+// contiguous in memory.
+static void siftDown4ary(vector<int>& arr, int n, int i, int value) {
+    int top = i;
+    int hole = i;
+
+    // Phase 1: down to a leaf following the largest child
+    int first = 4 * hole + 1;
+    while (first < n) {
+        int best = first;
+        int last = first + 4 < n ? first + 4 : n;
+        for (int c = first + 1; c < last; ++c) {
+            g_comparisons++;                   // compare sibling vs best so far
+            if (arr[c] > arr[best]) best = c;
+        }
+        arr[hole] = arr[best];
+        g_writes++;
+        hole = best;
+        first = 4 * hole + 1;
+    }
+
+    // Phase 2: bubble value back up
+    while (hole > top) {
+        int parent = (hole - 1) / 4;
+        g_comparisons++;                       // compare parent vs value
+        if (arr[parent] >= value) break;
+        arr[hole] = arr[parent];
+        g_writes++;
+        hole = parent;
+    }
+
+    arr[hole] = value;
+    g_writes++;
+}
+
+// heapSort4ary(arr)
+// -----------------
+// Heap sort on a 4-ary max-heap with hole-based moves and Floyd's sift-down.
+// The last internal node of a 4-ary heap is at (n - 2) / 4.
+void heapSort4ary(vector<int>& arr) {
+    g_comparisons = 0;
+    g_writes = 0;
+
+    int n = static_cast<int>(arr.size());
+    if (n <= 1) return;
+
+    // 1) Build max-heap bottom-up
+    for (int i = (n - 2) / 4; i >= 0; --i) {
+        siftDown4ary(arr, n, i, arr[i]);
+    }
 
-        // Restore heap property for the reduced heap [0 .. end-1]
-        heapify(arr, end, 0);
+    // 2) Extract
+    for (int end = n - 1; end > 0; --end) {
+        int value = arr[end];
+        arr[end] = arr[0];
+        g_writes++;
+        siftDown4ary(arr, end, 0, value);
     }
 }
 
 // ---------------------------------------------------------------------------
 // Test harness
 // ---------------------------------------------------------------------------
+// runVariant()
+// ------------
+// Sorts a copy of `input` with `sortFn`, verifies it against `expected` and
+// prints the step counts (total and per element).
+static bool runVariant(const string& name, void (*sortFn)(vector<int>&),
+                       const vector<int>& input, const vector<int>& expected) {
+    vector<int> arr = input;
+    sortFn(arr);
+    bool ok = (arr == expected);
+
+    double n = static_cast<double>(arr.size());
+    cout << "\n" << name << "\n";
+    cout << string(name.size(), '-') << "\n";
+    cout << "Comparisons:  " << g_comparisons << "  (" << g_comparisons / n << " per element)\n";
+    cout << "Writes:       " << g_writes << "  (" << g_writes / n << " per element)\n";
+    cout << "Correct?      " << (ok ? "YES \u2713" : "NO \u2717") << "\n";
+    return ok;
+}
+
 // - Load unordered + ordered (expected) arrays
 // - Heap-sort unordered in place
 // - Verify equality element-by-element
 // - Print step counts and PASS/FAIL
+// - Then compare the optimized variants on the same input
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // Load test data
     vector<int> unordered = loadFile("unordered.txt");
@@ -261,6 +371,9 @@ int main() {
         return 1;
     }
 
+    // Keep the input for the variant comparison below
+    vector<int> original = unordered;
+
     // Sort unordered data in place
     heapSort(unordered);
 
@@ -293,5 +406,12 @@ int main() {
         cout << "\n";
     }
 
+    // Optimized variants, with per-element costs for comparison
+    cout << "\n=== Variant comparison ===\n";
+    ok &= runVariant("Heap Sort (baseline)", heapSort, original, expected);
+    ok &= runVariant("Heap Sort, Floyd sift-down + hole moves", heapSortFloyd, original, expected);
+    ok &= runVariant("Heap Sort, 4-ary heap + Floyd sift-down", heapSort4ary, original, expected);
+
     return ok ? 0 : 1;
 }
+#endif // SECTION12_NO_MAIN
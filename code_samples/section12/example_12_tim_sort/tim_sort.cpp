@@ -0,0 +1,779 @@
+/*
+    tim_sort.cpp
+    ------------
+    Adaptive (natural, run-detecting) merge sort in the style of TimSort,
+    with step counting and file-based tests.
+
+    PURPOSE
+    -------
+    The plain merge sort in example_8 always splits the array in half, so it
+    performs all log2(n) merge levels even when the input is already sorted.
+    Real data is frequently "nearly sorted" (a sorted file plus a few appended
+    records, a descending export, ...). This program shows how an ADAPTIVE merge
+    sort exploits that existing order:
+
+      1) Scan left to right for NATURAL RUNS:
+           - ascending runs    (a[i] <= a[i+1] <= ...)
+           - strictly descending runs, which are reversed in place
+      2) Runs shorter than MIN_RUN are extended with BINARY INSERTION SORT.
+      3) Runs are pushed on a stack and merged while keeping the stack
+         invariant, so merges stay balanced:
+             len[i-2] > len[i-1] + len[i]
+             len[i-1] > len[i]
+      4) Merges use GALLOPING: when one run keeps "winning", we switch from
+         one-at-a-time comparisons to exponential search and copy whole blocks.
+
+    A fully sorted input is a single run: n - 1 comparisons and zero writes.
+
+    STEP COUNTING MODEL
+    -------------------
+    Same spirit as merge_sort.cpp:
+
+      - comparisons : every evaluation of a key comparison between two values
+                      (run detection, binary insertion, galloping, merging)
+      - writes      : every assignment into arr[] or the temp buffer
+                      (a swap while reversing a run counts as 3 writes)
+      - runs        : number of natural runs found by the scan
+
+    COMPLEXITY (Big-O)
+    ------------------
+    Best case:     O(n)        (input already sorted or reverse sorted)
+    Average case:  O(n log n)
+    Worst case:    O(n log n)
+    Extra space:   O(n / 2)    (temp buffer holds the smaller of two runs)
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
+#include "../common/fast_loader.hpp"
+
+using namespace std;
+
+// ------------------------------------------------------------
+// Step counting struct
+// ------------------------------------------------------------
+struct Stats {
+    long long comparisons = 0;
+    long long writes = 0;
+    long long runs = 0;
+};
+
+// ------------------------------------------------------------
+// Tuning constants (same values as Java's / Python's TimSort)
+// ------------------------------------------------------------
+static const int MIN_MERGE  = 32;  // arrays shorter than this are insertion sorted
+static const int MIN_GALLOP = 7;   // consecutive "wins" needed to enter galloping
+
+/*
+    Run
+    ---
+    One sorted run on the run stack: arr[base .. base+len).
+*/
+struct Run {
+    int base;
+    int len;
+};
+
+/*
+    TimState
+    --------
+    Everything one sort needs to share between its helpers:
+      - the array being sorted
+      - a temp buffer (grown on demand, never larger than n/2 + 1 in practice)
+      - the run stack
+      - the adaptive gallop threshold
+      - the step counters
+*/
+struct TimState {
+    vector<int>& a;
+    vector<int> tmp;
+    vector<Run> runs;
+    int minGallop = MIN_GALLOP;
+    Stats& stats;
+
+    TimState(vector<int>& arr, Stats& s) : a(arr), stats(s) {}
+};
+
+// ------------------------------------------------------------
+// Run detection and short-run extension
+// ------------------------------------------------------------
+
+/*
+    minRunLength()
+    --------------
+    Chooses the minimum run length for an array of size n.
+
+    Take the top 6 bits of n and add 1 if any of the remaining bits are set.
+    The result is in [MIN_MERGE/2, MIN_MERGE] and makes n / minRun equal to,
+    or slightly less than, a power of two - which keeps the final merges
+    balanced.
+*/
+static int minRunLength(int n)
+{
+    int r = 0;  // becomes 1 if any low bit is shifted off
+    while (n >= MIN_MERGE) {
+        r |= (n & 1);
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/*
+    reverseRange()
+    --------------
+    Reverses arr[lo .. hi) in place (used to turn a descending run ascending).
+    Each swap is counted as 3 writes, matching the other examples.
+*/
+static void reverseRange(vector<int>& a, int lo, int hi, Stats& stats)
+{
+    hi--;
+    while (lo < hi) {
+        int t = a[lo];
+        a[lo++] = a[hi];
+        a[hi--] = t;
+        stats.writes += 3;
+    }
+}
+
+/*
+    countRunAndMakeAscending()
+    --------------------------
+    Returns the length of the natural run starting at lo (never beyond hi).
+
+    - Ascending run:  a[lo] <= a[lo+1] <= a[lo+2] ...
+    - Descending run: a[lo] >  a[lo+1] >  a[lo+2] ... (STRICTLY descending,
+                      so reversing it cannot reorder equal keys - stability)
+
+    A descending run is reversed before returning, so the caller always
+    receives an ascending run.
+*/
+static int countRunAndMakeAscending(vector<int>& a, int lo, int hi, Stats& stats)
+{
+    int runHi = lo + 1;
+    if (runHi == hi) return 1;
+
+    stats.comparisons++;
+    if (a[runHi++] < a[lo]) {
+        // Strictly descending
+        while (runHi < hi) {
+            stats.comparisons++;
+            if (!(a[runHi] < a[runHi - 1])) break;
+            runHi++;
+        }
+        reverseRange(a, lo, runHi, stats);
+    } else {
+        // Ascending (non-decreasing)
+        while (runHi < hi) {
+            stats.comparisons++;
+            if (a[runHi] < a[runHi - 1]) break;
+            runHi++;
+        }
+    }
+
+    return runHi - lo;
+}
+
+/*
+    binaryInsertionSort()
+    ---------------------
+    Sorts a[lo .. hi) given that a[lo .. start) is already sorted.
+
+    Each new element finds its slot with binary search (O(log n) comparisons)
+    and the larger elements shift right by one (counted as writes).
+
+    Equal keys are inserted AFTER existing equal keys, which keeps the sort
+    stable.
+*/
+static void binaryInsertionSort(vector<int>& a, int lo, int hi, int start, Stats& stats)
+{
+    if (start == lo) start++;
+
+    for (; start < hi; start++) {
+        int pivot = a[start];
+
+        // Find the first position in [lo, start) whose value is > pivot
+        int left = lo;
+        int right = start;
+        while (left < right) {
+            int mid = (left + right) >> 1;
+            stats.comparisons++;
+            if (pivot < a[mid]) right = mid;
+            else                left = mid + 1;
+        }
+
+        // Shift a[left .. start) one slot to the right
+        for (int p = start; p > left; p--) {
+            a[p] = a[p - 1];
+            stats.writes++;
+        }
+
+        a[left] = pivot;
+        stats.writes++;
+    }
+}
+
+// ------------------------------------------------------------
+// Galloping (exponential + binary search inside a sorted run)
+// ------------------------------------------------------------
+
+/*
+    gallopLeft()
+    ------------
+    Locates the position at which to insert `key` into the sorted range
+    run[0 .. len), returning the LEFTMOST such position k:
+
+        run[k-1] < key <= run[k]
+
+    The search starts at `hint` and probes hint +/- 1, 3, 7, 15, ... until the
+    key is bracketed, then finishes with a binary search. When the answer is
+    close to the hint this costs O(log distance) comparisons instead of
+    O(log len).
+*/
+static int gallopLeft(int key, const int* run, int len, int hint, Stats& stats)
+{
+    int lastOfs = 0;
+    int ofs = 1;
+
+    stats.comparisons++;
+    if (key > run[hint]) {
+        // Gallop right until run[hint+lastOfs] < key <= run[hint+ofs]
+        int maxOfs = len - hint;
+        while (ofs < maxOfs) {
+            stats.comparisons++;
+            if (!(key > run[hint + ofs])) break;
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+
+        lastOfs += hint;
+        ofs += hint;
+    } else {
+        // Gallop left until run[hint-ofs] < key <= run[hint-lastOfs]
+        int maxOfs = hint + 1;
+        while (ofs < maxOfs) {
+            stats.comparisons++;
+            if (key > run[hint - ofs]) break;
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+
+        int t = lastOfs;
+        lastOfs = hint - ofs;
+        ofs = hint - t;
+    }
+
+    // Now run[lastOfs] < key <= run[ofs]; binary search in (lastOfs, ofs]
+    lastOfs++;
+    while (lastOfs < ofs) {
+        int m = lastOfs + ((ofs - lastOfs) >> 1);
+        stats.comparisons++;
+        if (key > run[m]) lastOfs = m + 1;
+        else              ofs = m;
+    }
+    return ofs;
+}
+
+/*
+    gallopRight()
+    -------------
+    Like gallopLeft(), but returns the RIGHTMOST insertion position k:
+
+        run[k-1] <= key < run[k]
+
+    Used when equal keys from the other run must be placed AFTER the ones in
+    this run (stability).
+*/
+static int gallopRight(int key, const int* run, int len, int hint, Stats& stats)
+{
+    int lastOfs = 0;
+    int ofs = 1;
+
+    stats.comparisons++;
+    if (key < run[hint]) {
+        // Gallop left until run[hint-ofs] <= key < run[hint-lastOfs]
+        int maxOfs = hint + 1;
+        while (ofs < maxOfs) {
+            stats.comparisons++;
+            if (!(key < run[hint - ofs])) break;
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+
+        int t = lastOfs;
+        lastOfs = hint - ofs;
+        ofs = hint - t;
+    } else {
+        // Gallop right until run[hint+lastOfs] <= key < run[hint+ofs]
+        int maxOfs = len - hint;
+        while (ofs < maxOfs) {
+            stats.comparisons++;
+            if (key < run[hint + ofs]) break;
+            lastOfs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxOfs) ofs = maxOfs;
+
+        lastOfs += hint;
+        ofs += hint;
+    }
+
+    // Now run[lastOfs] <= key < run[ofs]; binary search in (lastOfs, ofs]
+    lastOfs++;
+    while (lastOfs < ofs) {
+        int m = lastOfs + ((ofs - lastOfs) >> 1);
+        stats.comparisons++;
+        if (key < run[m]) ofs = m;
+        else              lastOfs = m + 1;
+    }
+    return ofs;
+}
+
+// ------------------------------------------------------------
+// Merging two adjacent runs
+// ------------------------------------------------------------
+
+/*
+    mergeLo()
+    ---------
+    Merges run1 = a[base1 .. base1+len1) and run2 = a[base2 .. base2+len2)
+    where base2 == base1 + len1 and len1 <= len2.
+
+    run1 (the smaller one) is copied to tmp, and the output is written from
+    the LEFT into a[base1 ..]. The write cursor can never overtake the run2
+    read cursor, so run2 can stay where it is.
+
+    Two modes:
+      - one-at-a-time: classic merge, counting how many times in a row the
+        same run supplied the next element
+      - galloping: once a run wins minGallop times in a row, find how many
+        elements it wins in one go with gallopRight()/gallopLeft() and copy
+        them as a block. minGallop adapts: it shrinks while galloping pays off
+        and grows when it does not.
+*/
+static void mergeLo(TimState& s, int base1, int len1, int base2, int len2)
+{
+    vector<int>& a = s.a;
+    Stats& stats = s.stats;
+
+    // Copy run1 to tmp
+    s.tmp.assign(a.begin() + base1, a.begin() + base1 + len1);
+    stats.writes += len1;
+
+    const int* t = s.tmp.data();
+    int i = 0, end1 = len1;              // cursor into tmp (run1)
+    int j = base2, end2 = base2 + len2;  // cursor into a   (run2)
+    int dest = base1;                    // write cursor
+    int minGallop = s.minGallop;
+
+    while (i < end1 && j < end2) {
+        int count1 = 0;  // consecutive wins by run1
+        int count2 = 0;  // consecutive wins by run2
+
+        // One-at-a-time mode
+        while (i < end1 && j < end2) {
+            stats.comparisons++;
+            if (a[j] < t[i]) {
+                a[dest++] = a[j++];
+                stats.writes++;
+                count2++;
+                count1 = 0;
+                if (count2 >= minGallop) break;
+            } else {
+                a[dest++] = t[i++];
+                stats.writes++;
+                count1++;
+                count2 = 0;
+                if (count1 >= minGallop) break;
+            }
+        }
+
+        // Galloping mode
+        while (i < end1 && j < end2) {
+            // How many run1 elements are <= a[j]? They all go first.
+            count1 = gallopRight(a[j], t + i, end1 - i, 0, stats);
+            for (int k = 0; k < count1; k++) a[dest++] = t[i++];
+            stats.writes += count1;
+            if (i >= end1) break;
+
+            a[dest++] = a[j++];
+            stats.writes++;
+            if (j >= end2) break;
+
+            // How many run2 elements are < t[i]? They all go first.
+            count2 = gallopLeft(t[i], &a[j], end2 - j, 0, stats);
+            for (int k = 0; k < count2; k++) a[dest++] = a[j++];
+            stats.writes += count2;
+            if (j >= end2) break;
+
+            a[dest++] = t[i++];
+            stats.writes++;
+            if (i >= end1) break;
+
+            if (minGallop > 1) minGallop--;
+            if (count1 < MIN_GALLOP && count2 < MIN_GALLOP) {
+                // Galloping stopped paying off; penalize re-entry
+                minGallop += 2;
+                break;
+            }
+        }
+    }
+
+    // Leftover run1 elements go at the end; leftover run2 is already in place
+    while (i < end1) {
+        a[dest++] = t[i++];
+        stats.writes++;
+    }
+
+    s.minGallop = minGallop < 1 ? 1 : minGallop;
+}
+
+/*
+    mergeHi()
+    ---------
+    Mirror image of mergeLo() for len1 > len2: run2 (the smaller one) is
+    copied to tmp, and the output is written from the RIGHT, starting at
+    a[base2 + len2 - 1] and walking down.
+
+    Ties go to run2 first (it is written at the higher index), which is what
+    keeps equal keys in their original order.
+*/
+static void mergeHi(TimState& s, int base1, int len1, int base2, int len2)
+{
+    vector<int>& a = s.a;
+    Stats& stats = s.stats;
+
+    // Copy run2 to tmp
+    s.tmp.assign(a.begin() + base2, a.begin() + base2 + len2);
+    stats.writes += len2;
+
+    const int* t = s.tmp.data();
+    int i = len2 - 1;                // cursor into tmp (run2), moving down
+    int j = base1 + len1 - 1;        // cursor into a   (run1), moving down
+    int dest = base2 + len2 - 1;     // write cursor, moving down
+    int minGallop = s.minGallop;
+
+    while (i >= 0 && j >= base1) {
+        int count1 = 0;  // consecutive wins by run1
+        int count2 = 0;  // consecutive wins by run2
+
+        // One-at-a-time mode
+        while (i >= 0 && j >= base1) {
+            stats.comparisons++;
+            if (t[i] < a[j]) {
+                a[dest--] = a[j--];
+                stats.writes++;
+                count1++;
+                count2 = 0;
+                if (count1 >= minGallop) break;
+            } else {
+                a[dest--] = t[i--];
+                stats.writes++;
+                count2++;
+                count1 = 0;
+                if (count2 >= minGallop) break;
+            }
+        }
+
+        // Galloping mode
+        while (i >= 0 && j >= base1) {
+            // How many run1 elements (from the top) are > t[i]?
+            int len1Left = j - base1 + 1;
+            count1 = len1Left - gallopRight(t[i], &a[base1], len1Left, len1Left - 1, stats);
+            for (int k = 0; k < count1; k++) a[dest--] = a[j--];
+            stats.writes += count1;
+            if (j < base1) break;
+
+            a[dest--] = t[i--];
+            stats.writes++;
+            if (i < 0) break;
+
+            // How many run2 elements (from the top) are >= a[j]?
+            count2 = (i + 1) - gallopLeft(a[j], t, i + 1, i, stats);
+            for (int k = 0; k < count2; k++) a[dest--] = t[i--];
+            stats.writes += count2;
+            if (i < 0) break;
+
+            a[dest--] = a[j--];
+            stats.writes++;
+            if (j < base1) break;
+
+            if (minGallop > 1) minGallop--;
+            if (count1 < MIN_GALLOP && count2 < MIN_GALLOP) {
+                minGallop += 2;
+                break;
+            }
+        }
+    }
+
+    // Leftover run2 elements go at the front; leftover run1 is already in place
+    while (i >= 0) {
+        a[dest--] = t[i--];
+        stats.writes++;
+    }
+
+    s.minGallop = minGallop < 1 ? 1 : minGallop;
+}
+
+/*
+    mergeAt()
+    ---------
+    Merges the runs at stack positions k and k+1 (k+1 must be the top or the
+    one below it).
+
+    Before merging, both ends are trimmed with galloping:
+      - run1 elements <= run2[0] are already in their final place
+      - run2 elements >= the last element of run1 are already in place
+    For two runs that barely overlap (the common case for nearly sorted
+    input) this reduces the merge to a handful of comparisons.
+*/
+static void mergeAt(TimState& s, int k)
+{
+    vector<int>& a = s.a;
+    int base1 = s.runs[k].base;
+    int len1  = s.runs[k].len;
+    int base2 = s.runs[k + 1].base;
+    int len2  = s.runs[k + 1].len;
+
+    // Record the merged run; drop run k+1 from the stack
+    s.runs[k].len = len1 + len2;
+    s.runs.erase(s.runs.begin() + k + 1);
+
+    // Skip the prefix of run1 that is already in place
+    int skip = gallopRight(a[base2], &a[base1], len1, 0, s.stats);
+    base1 += skip;
+    len1 -= skip;
+    if (len1 == 0) return;
+
+    // Skip the suffix of run2 that is already in place
+    len2 = gallopLeft(a[base1 + len1 - 1], &a[base2], len2, len2 - 1, s.stats);
+    if (len2 == 0) return;
+
+    // Merge using min(len1, len2) temp space
+    if (len1 <= len2) mergeLo(s, base1, len1, base2, len2);
+    else              mergeHi(s, base1, len1, base2, len2);
+}
+
+/*
+    mergeCollapse()
+    ---------------
+    Restores the run-stack invariants after a push:
+
+        len[n-2] > len[n-1] + len[n]
+        len[n-1] > len[n]
+
+    The second check on len[n-3] is the fix published in 2015 after the
+    original TimSort invariant was shown to be breakable.
+*/
+static void mergeCollapse(TimState& s)
+{
+    while (s.runs.size() > 1) {
+        int n = (int)s.runs.size() - 2;
+        const vector<Run>& r = s.runs;
+
+        if ((n > 0 && r[n - 1].len <= r[n].len + r[n + 1].len) ||
+            (n > 1 && r[n - 2].len <= r[n - 1].len + r[n].len)) {
+            if (r[n - 1].len < r[n + 1].len) n--;
+        } else if (r[n].len > r[n + 1].len) {
+            break;  // invariants hold
+        }
+
+        mergeAt(s, n);
+    }
+}
+
+/*
+    mergeForceCollapse()
+    --------------------
+    Merges everything left on the stack once the scan is finished.
+*/
+static void mergeForceCollapse(TimState& s)
+{
+    while (s.runs.size() > 1) {
+        int n = (int)s.runs.size() - 2;
+        if (n > 0 && s.runs[n - 1].len < s.runs[n + 1].len) n--;
+        mergeAt(s, n);
+    }
+}
+
+// ------------------------------------------------------------
+// Public entry point
+// ------------------------------------------------------------
+/*
+    timSort()
+    ---------
+    Stable, adaptive merge sort.
+
+    Note:
+        - Like mergeSort(), `stats` is NOT reset here; the caller provides a
+          fresh Stats to start counts at zero.
+*/
+void timSort(vector<int>& arr, Stats& stats)
+{
+    int n = (int)arr.size();
+    if (n < 2) return;
+
+    TimState s(arr, stats);
+    int minRun = minRunLength(n);
+
+    int lo = 0;
+    int remaining = n;
+    while (remaining > 0) {
+        // Find the next natural run
+        int runLen = countRunAndMakeAscending(arr, lo, n, stats);
+        stats.runs++;
+
+        // Extend short runs to min(minRun, remaining) with binary insertion
+        if (runLen < minRun) {
+            int force = remaining < minRun ? remaining : minRun;
+            binaryInsertionSort(arr, lo, lo + force, lo + runLen, stats);
+            runLen = force;
+        }
+
+        // Push run and merge while the invariants are violated
+        s.runs.push_back({ lo, runLen });
+        mergeCollapse(s);
+
+        lo += runLen;
+        remaining -= runLen;
+    }
+
+    mergeForceCollapse(s);
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+/*
+    loadFile()
+    ----------
+    Loads integers from a whitespace-separated text file, trying:
+
+      1) <CWD>/<filename>
+      2) <CWD>/data/<filename>
+      3) <CWD>/../data/<filename>
+      4) <CWD>/../../data/<filename>
+
+    Prints the path used on success; prints the attempts and exits on failure.
+*/
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    ifstream in;
+    string full;
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        full = string(prefixes[i]) + filename;
+        in.open(full);
+        if (in.is_open()) {
+            cout << "Loaded: " << full << "\n";
+            break;
+        }
+        in.clear();
+    }
+
+    if (!in.is_open()) {
+        cout << "Error reading: " << filename << "\n";
+        cout << "Search paths attempted:\n";
+        for (int i = 0; prefixes[i] != nullptr; ++i) {
+            cout << "  " << prefixes[i] << filename << "\n";
+        }
+        cout << "Missing input file — aborting.\n";
+        exit(1);
+    }
+
+    in.close();
+    vector<int> arr;
+    loadIntsFast(full, arr);  // bulk parser, ../common/fast_loader.hpp
+    return arr;
+}
+
+// ------------------------------------------------------------
+// Test harness
+// ------------------------------------------------------------
+/*
+    runCase()
+    ---------
+    Sorts a copy of `input`, checks it against `expected`, and prints one row
+    of step counts.
+*/
+static bool runCase(const string& name, const vector<int>& input, const vector<int>& expected)
+{
+    vector<int> arr = input;
+    Stats stats;
+    timSort(arr, stats);
+
+    bool ok = (arr == expected);
+
+    cout << name;
+    for (size_t pad = name.size(); pad < 16; pad++) cout << ' ';
+    cout << "runs=" << stats.runs
+         << "  comparisons=" << stats.comparisons
+         << "  writes=" << stats.writes
+         << "  " << (ok ? "PASS" : "FAIL") << "\n";
+    return ok;
+}
+
+/*
+    main()
+    ------
+    1) Load unordered.txt and ordered.txt
+    2) Build three extra inputs from ordered.txt:
+         - reversed      : one strictly descending run
+         - nearly sorted : every 100th value removed and appended at the end
+                           in scrambled order ("sorted file + a few appends")
+    3) Sort each with timSort() and verify against ordered.txt
+
+    For reference, the plain merge sort (example_8) does the same ~n log2 n
+    work on every one of these inputs.
+*/
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
+int main()
+{
+    vector<int> unordered = loadFile("unordered.txt");
+    vector<int> expected  = loadFile("ordered.txt");
+
+    if (unordered.size() != expected.size()) {
+        cout << "File lengths differ! unordered=" << unordered.size()
+             << ", ordered=" << expected.size() << "\n";
+        return 1;
+    }
+
+    vector<int> reversed(expected.rbegin(), expected.rend());
+
+    // Sorted prefix + ~1% of the values appended out of order
+    vector<int> nearly;
+    vector<int> appended;
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (i % 100 == 0) appended.push_back(expected[i]);
+        else              nearly.push_back(expected[i]);
+    }
+    unsigned seed = 12345;
+    for (size_t i = appended.size(); i > 1; i--) {
+        seed = seed * 1103515245u + 12345u;
+        swap(appended[i - 1], appended[seed % i]);
+    }
+    nearly.insert(nearly.end(), appended.begin(), appended.end());
+
+    cout << "\nTim Sort (C++) - n = " << expected.size()
+         << ", n - 1 = " << expected.size() - 1 << "\n";
+    cout << "----------------------------------------------------------------------\n";
+
+    bool ok = true;
+    ok &= runCase("unordered.txt", unordered, expected);
+    ok &= runCase("ordered.txt", expected, expected);
+    ok &= runCase("reversed", reversed, expected);
+    ok &= runCase("nearly sorted", nearly, expected);
+
+    cout << "\n" << (ok ? "SUCCESS — all outputs match expected sorted list!"
+                        : "FAIL — see rows above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
@@ -0,0 +1,594 @@
+/*
+    external_sort.cpp
+    -----------------
+    External (out-of-core) merge sort for integer files that do not fit in RAM.
+
+    PURPOSE
+    -------
+    Every other section12 example loads the whole file into a vector<int>
+    first. That stops working once the input is larger than memory. An
+    EXTERNAL sort only ever holds `budget` bytes of data at a time:
+
+      PHASE 1 - RUN FORMATION
+        - stream the input text file in chunks of budget / sizeof(int) values
+        - sort each chunk in memory (std::sort: introsort, the best general
+          in-memory sort available to a standalone example)
+        - write each sorted chunk ("run") to a binary temp file
+
+      PHASE 2 - K-WAY MERGE
+        - open up to maxFanIn runs at once, each with its own read buffer
+        - a LOSER TREE picks the smallest head value with ~log2(k)
+          comparisons per output value
+        - if there are more runs than maxFanIn, merge them in groups and
+          repeat (each extra pass reads and writes the data once more)
+        - the final pass writes the text output file
+
+    USAGE
+    -----
+        external_sort
+            Demo: sorts unordered.txt with a tiny 4 KB budget (forcing
+            several runs and two merge passes) and verifies the result
+            against ordered.txt.
+
+        external_sort <input.txt> <output.txt> <budgetMB> [tempDir]
+            Sorts a whitespace-separated integer file of any size.
+
+    REPORTED COSTS
+    --------------
+      - wall time per phase
+      - bytes read / written per phase and in total
+      - I/O amplification = total bytes moved / size of the input data
+
+    COMPLEXITY
+    ----------
+      Comparisons: O(n log n)
+      I/O:         O(n * passes), passes = 1 + ceil(log_k(runs / k))
+      Memory:      O(budget)
+*/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "../common/fast_loader.hpp"
+
+using namespace std;
+
+// ------------------------------------------------------------
+// I/O and work counters
+// ------------------------------------------------------------
+struct ExternalStats {
+    long long values = 0;             // integers sorted
+    long long runs = 0;               // sorted runs written in phase 1
+    long long mergePasses = 0;        // passes over the data in phase 2
+    long long comparisons = 0;        // loser-tree comparisons during merging
+    long long bytesRead = 0;          // all bytes read (input + temp files)
+    long long bytesWritten = 0;       // all bytes written (temp files + output)
+    long long inputBytes = 0;         // size of the text input
+    double runSeconds = 0.0;          // phase 1 wall time
+    double mergeSeconds = 0.0;        // phase 2 wall time
+};
+
+// ------------------------------------------------------------
+// Buffered text reader (streams ints, never loads the whole file)
+// ------------------------------------------------------------
+/*
+    TextIntReader
+    -------------
+    Reads whitespace-separated integers from a FILE* through a large buffer.
+    Parsing keeps its state (sign, digits so far) across buffer refills, so a
+    number split between two reads is handled correctly.
+*/
+class TextIntReader {
+public:
+    TextIntReader(FILE* f, size_t bufferBytes, ExternalStats& stats)
+        : f_(f), buf_(bufferBytes), stats_(stats) {}
+
+    // Returns false at end of file
+    bool next(int& out) {
+        bool neg = false;
+        bool inNumber = false;
+        long long value = 0;
+
+        while (true) {
+            if (pos_ == len_) {
+                len_ = fread(buf_.data(), 1, buf_.size(), f_);
+                pos_ = 0;
+                stats_.bytesRead += (long long)len_;
+                stats_.inputBytes += (long long)len_;
+                if (len_ == 0) {
+                    if (inNumber) {
+                        out = (int)(neg ? -value : value);
+                        return true;
+                    }
+                    return false;
+                }
+            }
+
+            char c = buf_[pos_++];
+            if (c >= '0' && c <= '9') {
+                value = value * 10 + (c - '0');
+                inNumber = true;
+            } else if (c == '-' && !inNumber) {
+                neg = true;
+            } else if (inNumber) {
+                out = (int)(neg ? -value : value);
+                return true;
+            } else {
+                neg = false;
+            }
+        }
+    }
+
+private:
+    FILE* f_;
+    vector<char> buf_;
+    size_t pos_ = 0;
+    size_t len_ = 0;
+    ExternalStats& stats_;
+};
+
+// ------------------------------------------------------------
+// Buffered binary run reader / writer
+// ------------------------------------------------------------
+/*
+    RunReader
+    ---------
+    Sequentially reads raw int32 values from one sorted run file.
+*/
+class RunReader {
+public:
+    RunReader(const string& path, size_t bufferInts, ExternalStats& stats)
+        : f_(fopen(path.c_str(), "rb")), buf_(max<size_t>(bufferInts, 1)), stats_(stats) {
+        if (!f_) {
+            cerr << "Error reading run file: " << path << "\n";
+            exit(1);
+        }
+    }
+
+    ~RunReader() { if (f_) fclose(f_); }
+
+    bool next(int& out) {
+        if (pos_ == len_) {
+            len_ = fread(buf_.data(), sizeof(int), buf_.size(), f_);
+            pos_ = 0;
+            stats_.bytesRead += (long long)(len_ * sizeof(int));
+            if (len_ == 0) return false;
+        }
+        out = buf_[pos_++];
+        return true;
+    }
+
+private:
+    FILE* f_;
+    vector<int> buf_;
+    size_t pos_ = 0;
+    size_t len_ = 0;
+    ExternalStats& stats_;
+};
+
+/*
+    OutputWriter
+    ------------
+    Buffered sink for either a binary run file or the final text file.
+    A short fwrite() or a failed fclose() (e.g. a full disk) is remembered
+    and reported by close(), so the caller never trusts a truncated file.
+*/
+class OutputWriter {
+public:
+    OutputWriter(const string& path, bool text, size_t bufferBytes, ExternalStats& stats)
+        : f_(fopen(path.c_str(), text ? "w" : "wb")), path_(path), text_(text),
+          buf_(max<size_t>(bufferBytes, 64)), stats_(stats) {
+        if (!f_) {
+            cerr << "Error writing: " << path << "\n";
+            exit(1);
+        }
+    }
+
+    ~OutputWriter() {
+        if (f_) close();
+    }
+
+    // Flushes and closes the file; returns false if any write failed
+    bool close() {
+        flush();
+        if (fclose(f_) != 0) ok_ = false;
+        f_ = nullptr;
+        if (!ok_) cerr << "Error writing: " << path_ << " (disk full?)\n";
+        return ok_;
+    }
+
+    void put(int x) {
+        if (len_ + 16 > buf_.size()) flush();
+
+        if (!text_) {
+            memcpy(&buf_[len_], &x, sizeof(int));
+            len_ += sizeof(int);
+            return;
+        }
+
+        // Text: space-separated decimal values, formatted by hand
+        if (first_) first_ = false;
+        else        buf_[len_++] = ' ';
+
+        unsigned int u = (unsigned int)x;
+        if (x < 0) {
+            buf_[len_++] = '-';
+            u = 0u - u;
+        }
+        char digits[12];
+        int d = 0;
+        do {
+            digits[d++] = (char)('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+        while (d > 0) buf_[len_++] = digits[--d];
+    }
+
+    void flush() {
+        if (len_ == 0) return;
+        if (fwrite(buf_.data(), 1, len_, f_) != len_) ok_ = false;
+        stats_.bytesWritten += (long long)len_;
+        len_ = 0;
+    }
+
+private:
+    FILE* f_;
+    string path_;
+    bool text_;
+    bool ok_ = true;
+    bool first_ = true;
+    vector<char> buf_;
+    size_t len_ = 0;
+    ExternalStats& stats_;
+};
+
+// ------------------------------------------------------------
+// Loser tree (tournament tree) for k-way merging
+// ------------------------------------------------------------
+/*
+    LoserTree
+    ---------
+    k sources are the leaves; every internal node remembers the LOSER of the
+    match played there, and tree_[0] holds the overall winner (smallest key).
+
+    After the winner's source advances, only the matches on the path from
+    that leaf to the root are replayed: exactly ceil(log2 k) comparisons,
+    versus ~2 log2 k for a binary heap's sift-down.
+
+    Layout: internal nodes 1 .. k-1, leaf i sits at virtual index k + i,
+    so the parent of node x is x / 2 for any k (not only powers of two).
+    Exhausted sources compare as +infinity.
+*/
+class LoserTree {
+public:
+    LoserTree(vector<RunReader*>& sources, ExternalStats& stats)
+        : k_((int)sources.size()), sources_(sources), keys_(k_), alive_(k_),
+          tree_(max(k_, 1)), stats_(stats) {
+        for (int i = 0; i < k_; i++) alive_[i] = sources_[i]->next(keys_[i]);
+        tree_[0] = build(1);
+    }
+
+    // Pops the smallest remaining value; returns false when all are empty
+    bool pop(int& out) {
+        if (k_ == 0) return false;
+
+        int w = tree_[0];
+        if (!alive_[w]) return false;
+
+        out = keys_[w];
+        alive_[w] = sources_[w]->next(keys_[w]);
+        replay(w);
+        return true;
+    }
+
+private:
+    // true if source a's head should be output before source b's head
+    bool less(int a, int b) {
+        if (!alive_[a]) return false;
+        if (!alive_[b]) return true;
+        stats_.comparisons++;
+        if (keys_[a] != keys_[b]) return keys_[a] < keys_[b];
+        return a < b;
+    }
+
+    // Plays the initial tournament below `node`; returns the subtree winner
+    int build(int node) {
+        if (node >= k_) return node - k_;
+
+        int l = build(2 * node);
+        int r = build(2 * node + 1);
+        if (less(l, r)) {
+            tree_[node] = r;
+            return l;
+        }
+        tree_[node] = l;
+        return r;
+    }
+
+    // Replays the matches from leaf s up to the root
+    void replay(int s) {
+        int winner = s;
+        for (int node = (s + k_) / 2; node >= 1; node /= 2) {
+            if (less(tree_[node], winner)) swap(tree_[node], winner);
+        }
+        tree_[0] = winner;
+    }
+
+    int k_;
+    vector<RunReader*>& sources_;
+    vector<int> keys_;
+    vector<char> alive_;
+    vector<int> tree_;
+    ExternalStats& stats_;
+};
+
+// ------------------------------------------------------------
+// External sort
+// ------------------------------------------------------------
+
+static double secondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static string runPath(const string& tempDir, long long pass, long long index)
+{
+    return tempDir + "/extsort_p" + to_string(pass) + "_r" + to_string(index) + ".bin";
+}
+
+// Size of each of the two phase-1 I/O buffers (read + write): 1/16th of
+// the budget, between 64 bytes and 1 MB
+static size_t ioBufferBytes(size_t budgetBytes)
+{
+    return max<size_t>(min<size_t>(budgetBytes / 16, 1 << 20), 64);
+}
+
+// Smallest budget that fits both I/O buffers plus a chunk of one int
+static size_t minBudgetBytes()
+{
+    return 2 * ioBufferBytes(0) + sizeof(int);
+}
+
+/*
+    formRuns()
+    ----------
+    Phase 1: reads the text input chunk by chunk, sorts each chunk in memory
+    and writes it as a binary run. Appends the run file names to `runs`;
+    returns false if a run could not be written completely.
+*/
+static bool formRuns(const string& inputPath, size_t budgetBytes,
+                     const string& tempDir, vector<string>& runs, ExternalStats& stats)
+{
+    FILE* in = fopen(inputPath.c_str(), "rb");
+    if (!in) {
+        cerr << "Error reading: " << inputPath << "\n";
+        exit(1);
+    }
+
+    // The read and write buffers come out of the budget too; the rest
+    // holds the chunk (budgetBytes >= minBudgetBytes(), see externalSort)
+    size_t ioBytes   = ioBufferBytes(budgetBytes);
+    size_t chunkInts = (budgetBytes - 2 * ioBytes) / sizeof(int);
+
+    TextIntReader reader(in, ioBytes, stats);
+    vector<int> chunk;
+    chunk.reserve(chunkInts);
+
+    bool more = true;
+    while (more) {
+        chunk.clear();
+        int x;
+        while (chunk.size() < chunkInts && (more = reader.next(x))) chunk.push_back(x);
+        if (chunk.empty()) break;
+
+        sort(chunk.begin(), chunk.end());
+
+        string path = runPath(tempDir, 0, (long long)runs.size());
+        OutputWriter w(path, false, ioBytes, stats);
+        for (int v : chunk) w.put(v);
+        runs.push_back(path);
+        if (!w.close()) {
+            fclose(in);
+            return false;
+        }
+        stats.values += (long long)chunk.size();
+    }
+
+    fclose(in);
+    stats.runs = (long long)runs.size();
+    return true;
+}
+
+/*
+    mergeGroup()
+    ------------
+    Merges the given runs into one destination (binary run or final text).
+    The budget is split evenly between k input buffers and 1 output buffer.
+    The input runs are deleted either way; returns false if dest could not
+    be written completely.
+*/
+static bool mergeGroup(const vector<string>& group, const string& dest, bool text,
+                       size_t budgetBytes, ExternalStats& stats)
+{
+    size_t bufferBytes = budgetBytes / (group.size() + 1);
+
+    vector<RunReader*> readers;
+    for (const string& path : group) {
+        readers.push_back(new RunReader(path, bufferBytes / sizeof(int), stats));
+    }
+
+    OutputWriter out(dest, text, bufferBytes, stats);
+    LoserTree tree(readers, stats);
+    int x;
+    while (tree.pop(x)) out.put(x);
+    bool ok = out.close();
+
+    for (RunReader* r : readers) delete r;
+    for (const string& path : group) remove(path.c_str());
+    return ok;
+}
+
+// Deletes the temporary runs left behind by a failed sort
+static void removeRuns(const vector<string>& runs)
+{
+    for (const string& path : runs) remove(path.c_str());
+}
+
+/*
+    externalSort()
+    --------------
+    Sorts inputPath into outputPath using at most ~budgetBytes of buffers.
+    Returns false (and sorts nothing) if budgetBytes is too small to hold
+    the I/O buffers - see minBudgetBytes() - or if writing a run or the
+    output fails; the temporary runs are removed in that case.
+*/
+bool externalSort(const string& inputPath, const string& outputPath,
+                  size_t budgetBytes, const string& tempDir, ExternalStats& stats)
+{
+    if (budgetBytes < minBudgetBytes()) {
+        cerr << "Error: budget of " << budgetBytes << " bytes is too small (minimum "
+             << minBudgetBytes() << " bytes)\n";
+        return false;
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<string> runs;
+    if (!formRuns(inputPath, budgetBytes, tempDir, runs, stats)) {
+        removeRuns(runs);
+        return false;
+    }
+    stats.runSeconds = secondsSince(start);
+
+    start = chrono::steady_clock::now();
+
+    // Widest merge whose buffers are still reasonably large
+    size_t minBuffer = max<size_t>(min<size_t>(budgetBytes / 8, 1 << 20), 64);
+    size_t maxFanIn  = max<size_t>(budgetBytes / minBuffer - 1, 2);
+
+    long long pass = 1;
+    while (runs.size() > maxFanIn) {
+        // Intermediate pass: groups of maxFanIn runs -> fewer, longer runs
+        vector<string> next;
+        for (size_t i = 0; i < runs.size(); i += maxFanIn) {
+            vector<string> group(runs.begin() + i, runs.begin() + min(i + maxFanIn, runs.size()));
+            string dest = runPath(tempDir, pass, (long long)next.size());
+            bool ok = mergeGroup(group, dest, false, budgetBytes, stats);
+            next.push_back(dest);
+            if (!ok) {
+                removeRuns(next);
+                removeRuns(vector<string>(runs.begin() + min(i + maxFanIn, runs.size()), runs.end()));
+                return false;
+            }
+        }
+        runs.swap(next);
+        stats.mergePasses++;
+        pass++;
+    }
+
+    // Final pass writes the text output
+    if (!mergeGroup(runs, outputPath, true, budgetBytes, stats)) return false;
+    stats.mergePasses++;
+    stats.mergeSeconds = secondsSince(start);
+    return true;
+}
+
+// ------------------------------------------------------------
+// Reporting
+// ------------------------------------------------------------
+static void printStats(size_t budgetBytes, const ExternalStats& s)
+{
+    double dataBytes = (double)s.values * sizeof(int);
+    double moved = (double)(s.bytesRead + s.bytesWritten);
+
+    cout << "\nExternal Merge Sort (C++)\n";
+    cout << "-------------------------\n";
+    cout << "Memory budget:      " << budgetBytes << " bytes\n";
+    cout << "Values:             " << s.values << " (" << (long long)dataBytes << " bytes as int32)\n";
+    cout << "Input text:         " << s.inputBytes << " bytes\n";
+    cout << "Runs formed:        " << s.runs << "\n";
+    cout << "Merge passes:       " << s.mergePasses << "\n";
+    cout << "Merge comparisons:  " << s.comparisons << "\n";
+    cout << "Bytes read:         " << s.bytesRead << "\n";
+    cout << "Bytes written:      " << s.bytesWritten << "\n";
+    if (dataBytes > 0) {
+        cout << "I/O amplification:  " << moved / dataBytes << "x the int32 data size\n";
+        cout << "Data / budget:      " << dataBytes / (double)budgetBytes << "\n";
+    }
+    cout << "Run formation time: " << s.runSeconds << " s\n";
+    cout << "Merge time:         " << s.mergeSeconds << " s\n";
+}
+
+// ------------------------------------------------------------
+// Demo helpers
+// ------------------------------------------------------------
+/*
+    findDataFile()
+    --------------
+    Returns the first existing path among the usual relative locations.
+*/
+static string findDataFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        string full = string(prefixes[i]) + filename;
+        ifstream probe(full);
+        if (probe.is_open()) return full;
+    }
+    cout << "Error reading: " << filename << " — aborting.\n";
+    exit(1);
+}
+
+static vector<int> loadFile(const string& path)
+{
+    vector<int> arr;
+    loadIntsFast(path, arr);
+    return arr;
+}
+
+// ------------------------------------------------------------
+// Main
+// ------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    if (argc >= 4) {
+        string tempDir = argc >= 5 ? argv[4] : ".";
+        size_t budgetBytes = (size_t)(atof(argv[3]) * 1024 * 1024);
+        if (budgetBytes < 1024) {
+            cerr << "Error: budget of " << argv[3] << " MB is below the 1024-byte minimum\n";
+            return 1;
+        }
+
+        ExternalStats stats;
+        if (!externalSort(argv[1], argv[2], budgetBytes, tempDir, stats)) return 1;
+        printStats(budgetBytes, stats);
+        return 0;
+    }
+
+    // Demo on the section12 data with a deliberately tiny budget
+    string unorderedPath = findDataFile("unordered.txt");
+    string orderedPath   = findDataFile("ordered.txt");
+    string outputPath    = "external_sort_output.txt";
+    size_t budgetBytes   = 4096;
+
+    cout << "Sorting " << unorderedPath << " with a " << budgetBytes << "-byte budget\n";
+
+    ExternalStats stats;
+    if (!externalSort(unorderedPath, outputPath, budgetBytes, ".", stats)) return 1;
+    printStats(budgetBytes, stats);
+
+    vector<int> got = loadFile(outputPath);
+    vector<int> expected = loadFile(orderedPath);
+    remove(outputPath.c_str());
+
+    bool ok = (got == expected);
+    cout << "\nCorrect?           " << (ok ? "YES — output matches ordered.txt"
+                                         : "NO — output differs from ordered.txt") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,301 @@
+/*
+    range_sort.cpp
+    --------------
+    Range-detecting sort: counting sort fast path for small-range keys,
+    radix sort or comparison sort otherwise. Step counting and file-based
+    tests, like the other section12 examples.
+
+    PURPOSE
+    -------
+    unordered.txt holds ~10k ints, all inside [-5000, 5000]. For data like
+    that a comparison sort is overkill: the KEY RANGE (max - min + 1) is about
+    the same as n, so we can simply COUNT how many times each value occurs
+    and write the values back in order - O(n + range), no comparisons at all.
+
+    rangeSort() picks a strategy after ONE scan for min and max:
+
+      1) range <= COUNTING_RANGE_FACTOR * n   -> COUNTING SORT
+             count[x - min]++ for every x, then rewrite arr from the counts
+      2) n >= RADIX_MIN_N                     -> LSD RADIX SORT on (x - min)
+             one 8-bit pass per byte actually used by (max - min), so a
+             range of 2^20 needs 3 passes instead of 4
+      3) otherwise                            -> COMPARISON SORT (std::sort)
+             small arrays: the counting/radix setup costs more than it saves
+
+    STEP COUNTING MODEL
+    -------------------
+      - comparisons : key comparisons (min/max scan counts 2 per element,
+                      comparison sort counts every comparator call)
+      - writes      : every assignment into arr[] or the radix buffer
+      - path        : which strategy rangeSort() chose, and why
+
+    COMPLEXITY (Big-O)
+    ------------------
+      Counting: O(n + range) time, O(range) extra space
+      Radix:    O(passes * n) time (passes <= 4), O(n) extra space
+      Fallback: O(n log n)
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+
+#include "../common/fast_loader.hpp"
+
+using namespace std;
+
+// ------------------------------------------------------------
+// Tuning constants
+// ------------------------------------------------------------
+static const long long COUNTING_RANGE_FACTOR = 4;        // range <= 4n -> counting sort
+static const long long COUNTING_MAX_RANGE    = 1 << 26;  // cap count[] at 256 MB
+static const int       RADIX_MIN_N           = 256;      // below this, comparison sort
+
+// ------------------------------------------------------------
+// Step counting struct
+// ------------------------------------------------------------
+enum class SortPath { None, Counting, Radix, Comparison };
+
+struct Stats {
+    long long comparisons = 0;
+    long long writes = 0;
+    SortPath path = SortPath::None;
+    long long range = 0;        // max - min + 1 found by the scan
+    int radixPasses = 0;        // byte passes used by the radix path
+};
+
+static const char* pathName(SortPath path)
+{
+    switch (path) {
+        case SortPath::Counting:   return "counting sort";
+        case SortPath::Radix:      return "LSD radix sort";
+        case SortPath::Comparison: return "comparison sort (std::sort)";
+        default:                   return "none (n < 2)";
+    }
+}
+
+// ------------------------------------------------------------
+// Strategies
+// ------------------------------------------------------------
+
+/*
+    countingSort()
+    --------------
+    count[v - lo] = occurrences of v, then write every value back in order.
+    Pure data movement: n writes, zero comparisons.
+*/
+static void countingSort(vector<int>& arr, int lo, long long range, Stats& stats)
+{
+    vector<int> count((size_t)range, 0);
+    for (int x : arr) count[(size_t)((long long)x - lo)]++;
+
+    size_t k = 0;
+    for (long long v = 0; v < range; v++) {
+        for (int c = count[(size_t)v]; c > 0; c--) {
+            arr[k++] = (int)(lo + v);
+            stats.writes++;
+        }
+    }
+}
+
+/*
+    radixSort()
+    -----------
+    LSD radix sort on the unsigned offsets (x - lo), 8 bits per pass.
+
+    Subtracting lo makes every key non-negative and as small as possible, so
+    only the low `passes` bytes can differ; higher bytes are all zero and are
+    skipped entirely. Each pass is a stable counting sort on one byte.
+*/
+static void radixSort(vector<int>& arr, int lo, int hi, Stats& stats)
+{
+    uint32_t span = (uint32_t)hi - (uint32_t)lo;
+    int passes = 1;
+    while (passes < 4 && (span >> (8 * passes)) != 0) passes++;
+    stats.radixPasses = passes;
+
+    size_t n = arr.size();
+    vector<int> buf(n);
+    int* src = arr.data();
+    int* dst = buf.data();
+
+    for (int p = 0; p < passes; p++) {
+        int shift = 8 * p;
+        size_t count[257] = { 0 };
+
+        // Histogram of this byte
+        for (size_t i = 0; i < n; i++) {
+            uint32_t key = (uint32_t)src[i] - (uint32_t)lo;
+            count[((key >> shift) & 0xFF) + 1]++;
+        }
+
+        // Prefix sums -> first output slot for each byte value
+        for (int b = 0; b < 256; b++) count[b + 1] += count[b];
+
+        // Stable scatter
+        for (size_t i = 0; i < n; i++) {
+            uint32_t key = (uint32_t)src[i] - (uint32_t)lo;
+            dst[count[(key >> shift) & 0xFF]++] = src[i];
+        }
+        stats.writes += (long long)n;
+
+        swap(src, dst);
+    }
+
+    // After an odd number of passes the result is in buf
+    if (src != arr.data()) {
+        copy(buf.begin(), buf.end(), arr.begin());
+        stats.writes += (long long)n;
+    }
+}
+
+/*
+    comparisonSort()
+    ----------------
+    std::sort with a comparator that counts its calls.
+*/
+static void comparisonSort(vector<int>& arr, Stats& stats)
+{
+    sort(arr.begin(), arr.end(), [&stats](int a, int b) {
+        stats.comparisons++;
+        return a < b;
+    });
+    stats.writes += (long long)arr.size();  // approximation: each value placed once
+}
+
+// ------------------------------------------------------------
+// Public entry point
+// ------------------------------------------------------------
+/*
+    rangeSort()
+    -----------
+    Scans once for min and max, then picks counting / radix / comparison
+    sort as described at the top of the file. The choice is recorded in
+    stats.path (the caller provides a fresh Stats).
+*/
+void rangeSort(vector<int>& arr, Stats& stats)
+{
+    size_t n = arr.size();
+    if (n < 2) return;
+
+    // One pass for min and max (2 comparisons per element)
+    int lo = arr[0];
+    int hi = arr[0];
+    for (size_t i = 1; i < n; i++) {
+        stats.comparisons += 2;
+        if (arr[i] < lo) lo = arr[i];
+        if (arr[i] > hi) hi = arr[i];
+    }
+    stats.range = (long long)hi - (long long)lo + 1;
+
+    if (stats.range <= COUNTING_RANGE_FACTOR * (long long)n &&
+        stats.range <= COUNTING_MAX_RANGE) {
+        stats.path = SortPath::Counting;
+        countingSort(arr, lo, stats.range, stats);
+    } else if ((int)n >= RADIX_MIN_N) {
+        stats.path = SortPath::Radix;
+        radixSort(arr, lo, hi, stats);
+    } else {
+        stats.path = SortPath::Comparison;
+        comparisonSort(arr, stats);
+    }
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    ifstream in;
+    string full;
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        full = string(prefixes[i]) + filename;
+        in.open(full);
+        if (in.is_open()) {
+            cout << "Loaded: " << full << "\n";
+            break;
+        }
+        in.clear();
+    }
+
+    if (!in.is_open()) {
+        cout << "Error reading: " << filename << "\n";
+        cout << "Missing input file — aborting.\n";
+        exit(1);
+    }
+
+    in.close();
+    vector<int> arr;
+    loadIntsFast(full, arr);  // bulk parser, ../common/fast_loader.hpp
+    return arr;
+}
+
+// ------------------------------------------------------------
+// Test harness
+// ------------------------------------------------------------
+/*
+    runCase()
+    ---------
+    Sorts a copy of `input` with rangeSort(), verifies against `expected`
+    and prints the chosen path with the step counts.
+*/
+static bool runCase(const string& name, const vector<int>& input, const vector<int>& expected)
+{
+    vector<int> arr = input;
+    Stats stats;
+    rangeSort(arr, stats);
+    bool ok = (arr == expected);
+
+    cout << "\n--- " << name << " (n = " << arr.size() << ") ---\n";
+    cout << "Range:        " << stats.range << "\n";
+    cout << "Path:         " << pathName(stats.path);
+    if (stats.path == SortPath::Radix) cout << ", " << stats.radixPasses << " byte passes";
+    cout << "\n";
+    cout << "Comparisons:  " << stats.comparisons << "\n";
+    cout << "Writes:       " << stats.writes << "\n";
+    cout << "Correct?      " << (ok ? "YES" : "NO") << "\n";
+    return ok;
+}
+
+/*
+    main()
+    ------
+    1) unordered.txt as-is         -> small range, counting sort
+    2) unordered.txt * 100003      -> same order, huge range, radix sort
+    3) first 100 values            -> too small for radix, comparison sort
+*/
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
+int main()
+{
+    vector<int> unordered = loadFile("unordered.txt");
+    vector<int> expected  = loadFile("ordered.txt");
+
+    if (unordered.size() != expected.size()) {
+        cout << "File lengths differ! unordered=" << unordered.size()
+             << ", ordered=" << expected.size() << "\n";
+        return 1;
+    }
+
+    bool ok = runCase("unordered.txt", unordered, expected);
+
+    vector<int> wide = unordered;
+    vector<int> wideExpected = expected;
+    for (int& x : wide) x *= 100003;
+    for (int& x : wideExpected) x *= 100003;
+    ok &= runCase("unordered.txt x 100003", wide, wideExpected);
+
+    vector<int> small(wide.begin(), wide.begin() + min<size_t>(100, wide.size()));
+    vector<int> smallExpected = small;
+    sort(smallExpected.begin(), smallExpected.end());
+    ok &= runCase("first 100 wide values", small, smallExpected);
+
+    cout << "\n" << (ok ? "SUCCESS — all outputs sorted correctly!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
@@ -0,0 +1,332 @@
+/*
+    generic_sort.cpp
+    ----------------
+    Demo/test harness for common/generic_sort.hpp: the section12 sorts as
+    iterator + comparator templates with an optional step-counting policy.
+
+    WHAT THIS SHOWS
+    ---------------
+    1) Step counts
+         Each gsort:: sort runs on unordered.txt with gsort::CountStats and
+         prints comparisons / writes / swaps. selection_sort.cpp,
+         bubble_sort.cpp, insertion_sort.cpp, merge_sort.cpp and
+         heap_sort.cpp call these same templates, so their counts are
+         identical. quick_sort.cpp keeps its last-element Lomuto pivot (the
+         reference for its SIMD partitions), so its counts differ from
+         gsort::quickSort (median of three + three-way partition).
+
+    2) Inputs that break a last-element Lomuto pivot
+         All-equal, sorted and reverse-sorted input. gsort::quickSort must
+         stay near n log n comparisons on all of them.
+
+    3) The int path costs nothing extra
+         gsort::quickSort with the default NoStats policy is timed against
+         the SAME algorithm hand-written for int (no counters). Runs are
+         interleaved and the minimum of each is reported.
+
+    4) Other element types
+         long long keys, float, descending order (std::greater<>), and
+         64-byte records sorted by key with a lambda. Every output must
+         equal a std::stable_sort of the input; for records the unstable
+         sorts (quick, heap, selection) only need to be sorted and hold
+         exactly the input's records, while the stable sorts (merge,
+         insertion, bubble) must keep equal keys in input order.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <cstddef>
+#include <chrono>
+#include <functional>
+
+#include "../common/generic_sort.hpp"
+#include "../common/fast_loader.hpp"
+
+using namespace std;
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    ifstream in;
+    string full;
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        full = string(prefixes[i]) + filename;
+        in.open(full);
+        if (in.is_open()) {
+            cout << "Loaded: " << full << "\n";
+            break;
+        }
+        in.clear();
+    }
+
+    if (!in.is_open()) {
+        cout << "Error reading: " << filename << "\n";
+        cout << "Missing input file — aborting.\n";
+        exit(1);
+    }
+
+    in.close();
+    vector<int> arr;
+    loadIntsFast(full, arr);  // bulk parser, ../common/fast_loader.hpp
+    return arr;
+}
+
+// ------------------------------------------------------------
+// Record type: 8-byte key, input position, 52 bytes of payload (64 total)
+// ------------------------------------------------------------
+struct Record {
+    long long key;
+    int order;          // input position, used to check stability
+    char payload[52];
+};
+
+static bool operator==(const Record& a, const Record& b)
+{
+    return a.key == b.key && a.order == b.order;
+}
+
+// (key, order) identifies a record: sorting by it puts any arrangement of
+// the same records into one canonical order
+static bool byKeyThenOrder(const Record& a, const Record& b)
+{
+    return a.key != b.key ? a.key < b.key : a.order < b.order;
+}
+
+// ------------------------------------------------------------
+// Int-only baseline (gsort::quickSort written out for int, no counters)
+// ------------------------------------------------------------
+static void quickSortIntOnly(int* first, int* last)
+{
+    while (last - first > 1) {
+        int* mid = first + (last - first) / 2;
+        int* back = last - 1;
+        if (*mid < *first) swap(*mid, *first);
+        if (*back < *mid) {
+            swap(*back, *mid);
+            if (*mid < *first) swap(*mid, *first);
+        }
+        const int pivot = *mid;
+
+        // [first, a) ==   [a, b) <   [b, c) unscanned   [c, d) >   [d, last) ==
+        int *a = first, *b = first, *c = last, *d = last;
+        for (;;) {
+            for (; b != c && !(pivot < *b); ++b) {
+                if (!(*b < pivot)) swap(*a++, *b);
+            }
+            for (; b != c && !(*(c - 1) < pivot); ) {
+                --c;
+                if (!(pivot < *c)) swap(*c, *--d);
+            }
+            if (b == c) break;
+            swap(*b++, *--c);
+        }
+        // Move the parked equal keys from both ends into the middle
+        ptrdiff_t n = min(a - first, b - a);
+        swap_ranges(first, first + n, b - n);
+        n = min(last - d, d - c);
+        swap_ranges(b, b + n, last - n);
+        int* lt = first + (b - a);
+        int* gt = last - (d - c);
+
+        if (lt - first < last - gt) {
+            quickSortIntOnly(first, lt);
+            first = gt;
+        } else {
+            quickSortIntOnly(gt, last);
+            last = lt;
+        }
+    }
+}
+
+// ------------------------------------------------------------
+// Part 1: step counts on unordered.txt
+// ------------------------------------------------------------
+typedef void (*CountedSort)(vector<int>::iterator, vector<int>::iterator,
+                            less<>, gsort::CountStats&);
+
+static bool runCounted(const string& name, CountedSort sortFn,
+                       const vector<int>& input, const vector<int>& expected)
+{
+    vector<int> arr = input;
+    gsort::CountStats stats;
+    sortFn(arr.begin(), arr.end(), less<>(), stats);
+    bool ok = (arr == expected);
+
+    cout << "  " << name;
+    for (size_t pad = name.size(); pad < 15; pad++) cout << ' ';
+    cout << "comparisons " << stats.comparisons
+         << ", writes " << stats.writes
+         << ", swaps " << stats.swaps
+         << (ok ? "  OK" : "  WRONG") << "\n";
+    return ok;
+}
+
+// ------------------------------------------------------------
+// Part 4 helpers
+// ------------------------------------------------------------
+/*
+    sameSorted()
+    ------------
+    An unstable sort may order equal keys differently from `expected`
+    (a stable_sort of the input), so compare with that only where equal
+    elements are indistinguishable. Records carry their input position:
+    check the result is sorted and holds exactly the input's records.
+*/
+template <class T, class Compare>
+static bool sameSorted(const vector<T>& result, const vector<T>& expected, Compare)
+{
+    return result == expected;
+}
+
+template <class Compare>
+static bool sameSorted(const vector<Record>& result, const vector<Record>& expected, Compare cmp)
+{
+    if (!is_sorted(result.begin(), result.end(), cmp)) return false;
+    vector<Record> a = result, b = expected;
+    sort(a.begin(), a.end(), byKeyThenOrder);
+    sort(b.begin(), b.end(), byKeyThenOrder);
+    return a == b;
+}
+
+template <class T, class Compare>
+static bool checkAllSorts(const string& name, const vector<T>& input, Compare cmp)
+{
+    vector<T> expected = input;
+    stable_sort(expected.begin(), expected.end(), cmp);
+
+    // Quadratic sorts get a prefix so the demo stays quick
+    size_t smallN = min<size_t>(input.size(), 2000);
+    vector<T> smallInput(input.begin(), input.begin() + smallN);
+    vector<T> smallExpected = smallInput;
+    stable_sort(smallExpected.begin(), smallExpected.end(), cmp);
+
+    bool ok = true;
+    vector<T> a;
+
+    a = input;      gsort::quickSort(a.begin(), a.end(), cmp);      ok &= sameSorted(a, expected, cmp);
+    a = input;      gsort::heapSort(a.begin(), a.end(), cmp);       ok &= sameSorted(a, expected, cmp);
+    a = input;      gsort::mergeSort(a.begin(), a.end(), cmp);      ok &= (a == expected);
+    a = smallInput; gsort::insertionSort(a.begin(), a.end(), cmp);  ok &= (a == smallExpected);
+    a = smallInput; gsort::bubbleSort(a.begin(), a.end(), cmp);     ok &= (a == smallExpected);
+    a = smallInput; gsort::selectionSort(a.begin(), a.end(), cmp);  ok &= sameSorted(a, smallExpected, cmp);
+
+    cout << "  " << name;
+    for (size_t pad = name.size(); pad < 30; pad++) cout << ' ';
+    cout << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+int main()
+{
+    vector<int> unordered = loadFile("unordered.txt");
+    vector<int> expected  = loadFile("ordered.txt");
+
+    if (unordered.size() != expected.size()) {
+        cout << "File lengths differ! unordered=" << unordered.size()
+             << ", ordered=" << expected.size() << "\n";
+        return 1;
+    }
+
+    bool ok = true;
+
+    // --------------------------------------------------------
+    // 1) Step counts (CountStats) on ints
+    // --------------------------------------------------------
+    typedef vector<int>::iterator It;
+    cout << "\n--- Step counts, gsort:: on unordered.txt ---\n";
+    ok &= runCounted("quickSort",     gsort::quickSort<It, less<>, gsort::CountStats>,     unordered, expected);
+    ok &= runCounted("mergeSort",     gsort::mergeSort<It, less<>, gsort::CountStats>,     unordered, expected);
+    ok &= runCounted("heapSort",      gsort::heapSort<It, less<>, gsort::CountStats>,      unordered, expected);
+    ok &= runCounted("insertionSort", gsort::insertionSort<It, less<>, gsort::CountStats>, unordered, expected);
+    ok &= runCounted("selectionSort", gsort::selectionSort<It, less<>, gsort::CountStats>, unordered, expected);
+    ok &= runCounted("bubbleSort",    gsort::bubbleSort<It, less<>, gsort::CountStats>,    unordered, expected);
+
+    // --------------------------------------------------------
+    // 2) Adversarial inputs for quickSort
+    // --------------------------------------------------------
+    const size_t edgeN = 100000;
+    vector<int> allEqual(edgeN, 7);
+    vector<int> ascending(edgeN), descending(edgeN);
+    for (size_t i = 0; i < edgeN; i++) {
+        ascending[i] = (int)i;
+        descending[i] = (int)(edgeN - i);
+    }
+    vector<int> sortedEqual = allEqual, sortedDesc = descending;
+    sort(sortedDesc.begin(), sortedDesc.end());
+
+    cout << "\n--- quickSort on n = " << edgeN << " (Lomuto would need ~"
+         << edgeN * (edgeN - 1) / 2 << " comparisons) ---\n";
+    ok &= runCounted("all equal",  gsort::quickSort<It, less<>, gsort::CountStats>, allEqual,   sortedEqual);
+    ok &= runCounted("ascending",  gsort::quickSort<It, less<>, gsort::CountStats>, ascending,  ascending);
+    ok &= runCounted("descending", gsort::quickSort<It, less<>, gsort::CountStats>, descending, sortedDesc);
+
+    // --------------------------------------------------------
+    // 3) NoStats template vs int-only code
+    // --------------------------------------------------------
+    // unordered.txt repeated with a different offset per copy
+    const size_t timingN = 1000000;
+    vector<int> big(timingN);
+    for (size_t i = 0; i < timingN; i++) {
+        big[i] = unordered[i % unordered.size()] + (int)(i / unordered.size()) * 7919;
+    }
+    vector<int> bigExpected = big;
+    sort(bigExpected.begin(), bigExpected.end());
+
+    const int reps = 11;
+    double intOnlyMs = 1e30, genericMs = 1e30;
+    for (int r = 0; r < reps; r++) {
+        vector<int> a = big;
+        auto t0 = chrono::steady_clock::now();
+        quickSortIntOnly(a.data(), a.data() + a.size());
+        auto t1 = chrono::steady_clock::now();
+        intOnlyMs = min(intOnlyMs, chrono::duration<double, milli>(t1 - t0).count());
+        ok &= (a == bigExpected);
+
+        vector<int> b = big;
+        t0 = chrono::steady_clock::now();
+        gsort::quickSort(b.begin(), b.end());
+        t1 = chrono::steady_clock::now();
+        genericMs = min(genericMs, chrono::duration<double, milli>(t1 - t0).count());
+        ok &= (b == bigExpected);
+    }
+    cout << "\n--- Quick sort timing, n = " << timingN << " (min of " << reps
+         << " interleaved runs) ---\n";
+    cout << "  int-only:             " << intOnlyMs << " ms\n";
+    cout << "  gsort (NoStats):      " << genericMs << " ms\n";
+
+    // --------------------------------------------------------
+    // 4) Other element types and comparators
+    // --------------------------------------------------------
+    cout << "\n--- Other element types ---\n";
+
+    vector<long long> wide(unordered.size());
+    for (size_t i = 0; i < unordered.size(); i++) wide[i] = (long long)unordered[i] * (1LL << 33);
+    ok &= checkAllSorts("long long (key * 2^33)", wide, less<>());
+
+    vector<float> floats(unordered.size());
+    for (size_t i = 0; i < unordered.size(); i++) floats[i] = unordered[i] / 7.0f;
+    ok &= checkAllSorts("float (value / 7)", floats, less<>());
+
+    ok &= checkAllSorts("int, descending", unordered, greater<>());
+
+    // Records: key = value / 10 gives ~10 equal keys per group
+    vector<Record> records(unordered.size());
+    for (size_t i = 0; i < unordered.size(); i++) {
+        records[i].key = unordered[i] / 10;
+        records[i].order = (int)i;
+        fill(begin(records[i].payload), end(records[i].payload), (char)i);
+    }
+    ok &= checkAllSorts("Record (64 bytes) by key", records,
+                        [](const Record& a, const Record& b) { return a.key < b.key; });
+
+    cout << "\n" << (ok ? "SUCCESS — all outputs sorted correctly!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
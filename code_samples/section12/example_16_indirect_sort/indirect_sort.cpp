@@ -0,0 +1,348 @@
+/*
+    indirect_sort.cpp
+    -----------------
+    Key-pointer (indirect) sorting for records with large payloads, compared
+    with sorting the records directly.
+
+    THE PROBLEM
+    -----------
+    Every section12 sort moves whole elements. For int that is 4 bytes per
+    move; for a 256-byte record it is 64x more memory traffic, and a
+    comparison sort moves each element ~log2(n) times.
+
+    INDIRECT SORT
+    -------------
+    1) Extract a compact (key, index) pair per record, packed in one uint64:
+
+           high 32 bits = key with the sign bit flipped (so unsigned order
+                          matches signed order)
+           low  32 bits = index of the record
+
+    2) Sort the pairs with the fast int path: LSD radix sort on the 4 key
+       bytes only (the index rides along). Bytes that are identical in every
+       key are skipped, as in range_sort.cpp. Radix passes are stable, so
+       records with equal keys stay in input order.
+
+    3) Apply the permutation ONCE: perm[i] = index of the record that
+       belongs at position i. Each record is moved exactly once (or twice).
+
+    APPLYING THE PERMUTATION
+    ------------------------
+    a) Gather with prefetch (out of place)
+           out[i] = rec[perm[i]]
+       Writes are sequential; reads are random, so we prefetch the record
+       needed PREFETCH_DISTANCE iterations ahead. Needs a second record array.
+
+    b) Cycle following (in place)
+           Follow each cycle of the permutation with one saved record:
+               tmp = rec[i]; rec[i] = rec[perm[i]]; rec[perm[i]] = ...
+           O(1) extra records, every record moved once (+1 per cycle), but
+           both reads and writes jump around memory.
+
+    MEASURED
+    --------
+    Records of 64, 128 and 256 bytes, n = 10,000 (unordered.txt keys) and
+    n = 1,000,000 (generated keys), each sorted:
+        - directly with std::sort on the records
+        - indirectly, permutation applied by gather
+        - indirectly, permutation applied by cycle following
+    All three must produce the same key order as ordered.txt / std::sort.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+#include "../common/fast_loader.hpp"
+
+// Prefetch hint where the compiler has one; elsewhere it compiles away
+#if defined(__GNUC__)
+    #define INDIRECT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+    #define INDIRECT_PREFETCH(addr) ((void)(addr))
+#endif
+
+using namespace std;
+
+static const size_t PREFETCH_DISTANCE = 8;   // records ahead in the gather loop
+static const size_t LARGE_N = 1000000;       // generated benchmark size
+
+// ------------------------------------------------------------
+// Record with a key, its input position and a payload
+// ------------------------------------------------------------
+template <size_t Bytes>
+struct Record {
+    int key;
+    int id;                      // input position (checks stability)
+    char payload[Bytes - 8];
+};
+
+// ------------------------------------------------------------
+// Step 1 + 2: build and radix-sort (key, index) pairs
+// ------------------------------------------------------------
+/*
+    sortKeyIndex()
+    --------------
+    Sorts packed (key, index) pairs by key with LSD radix sort on the key
+    bytes. A byte position is skipped when every key has the same value in
+    it (e.g. the top two bytes for keys in [-5000, 5000]).
+*/
+static void sortKeyIndex(vector<uint64_t>& pairs)
+{
+    size_t n = pairs.size();
+    vector<uint64_t> buf(n);
+    uint64_t* src = pairs.data();
+    uint64_t* dst = buf.data();
+
+    for (int b = 0; b < 4; b++) {
+        int shift = 32 + 8 * b;
+        size_t count[257] = { 0 };
+        for (size_t i = 0; i < n; i++) count[((src[i] >> shift) & 0xFF) + 1]++;
+
+        // Every key has the same byte here: nothing to do this pass
+        if (n == 0 || count[((src[0] >> shift) & 0xFF) + 1] == n) continue;
+
+        for (int d = 0; d < 256; d++) count[d + 1] += count[d];
+        for (size_t i = 0; i < n; i++) dst[count[(src[i] >> shift) & 0xFF]++] = src[i];
+        swap(src, dst);
+    }
+
+    if (src != pairs.data()) copy(buf.begin(), buf.end(), pairs.begin());
+}
+
+/*
+    sortedPermutation()
+    -------------------
+    Returns perm with perm[i] = index of the record that belongs at
+    position i after sorting by key.
+*/
+template <class Rec>
+static vector<uint32_t> sortedPermutation(const vector<Rec>& recs)
+{
+    vector<uint64_t> pairs(recs.size());
+    for (size_t i = 0; i < recs.size(); i++) {
+        uint32_t biased = (uint32_t)recs[i].key ^ 0x80000000u;
+        pairs[i] = ((uint64_t)biased << 32) | (uint32_t)i;
+    }
+
+    sortKeyIndex(pairs);
+
+    vector<uint32_t> perm(pairs.size());
+    for (size_t i = 0; i < pairs.size(); i++) perm[i] = (uint32_t)pairs[i];
+    return perm;
+}
+
+// ------------------------------------------------------------
+// Step 3: apply the permutation
+// ------------------------------------------------------------
+/*
+    applyGather()
+    -------------
+    out[i] = recs[perm[i]], then swap out into recs. Sequential writes,
+    random reads hidden by prefetching PREFETCH_DISTANCE records ahead.
+*/
+template <class Rec>
+static void applyGather(vector<Rec>& recs, const vector<uint32_t>& perm)
+{
+    size_t n = recs.size();
+    vector<Rec> out(n);
+
+    for (size_t i = 0; i < n; i++) {
+        if (i + PREFETCH_DISTANCE < n) {
+            const char* ahead = (const char*)&recs[perm[i + PREFETCH_DISTANCE]];
+            for (size_t line = 0; line < sizeof(Rec); line += 64) {
+                INDIRECT_PREFETCH(ahead + line);
+            }
+        }
+        out[i] = recs[perm[i]];
+    }
+
+    recs.swap(out);
+}
+
+/*
+    applyCycles()
+    -------------
+    In-place permutation by cycle following. perm is consumed: each visited
+    slot is marked by setting perm[j] = j.
+*/
+template <class Rec>
+static void applyCycles(vector<Rec>& recs, vector<uint32_t>& perm)
+{
+    size_t n = recs.size();
+    for (size_t start = 0; start < n; start++) {
+        if (perm[start] == start) continue;   // fixed point or already placed
+
+        Rec tmp = recs[start];
+        size_t j = start;
+        while (perm[j] != start) {
+            size_t from = perm[j];
+            recs[j] = recs[from];
+            perm[j] = (uint32_t)j;
+            j = from;
+        }
+        recs[j] = tmp;
+        perm[j] = (uint32_t)j;
+    }
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    ifstream in;
+    string full;
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        full = string(prefixes[i]) + filename;
+        in.open(full);
+        if (in.is_open()) {
+            cout << "Loaded: " << full << "\n";
+            break;
+        }
+        in.clear();
+    }
+
+    if (!in.is_open()) {
+        cout << "Error reading: " << filename << "\n";
+        cout << "Missing input file — aborting.\n";
+        exit(1);
+    }
+
+    in.close();
+    vector<int> arr;
+    loadIntsFast(full, arr);  // bulk parser, ../common/fast_loader.hpp
+    return arr;
+}
+
+// ------------------------------------------------------------
+// Benchmark harness
+// ------------------------------------------------------------
+template <class Rec>
+static vector<Rec> makeRecords(const vector<int>& keys)
+{
+    vector<Rec> recs(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        recs[i].key = keys[i];
+        recs[i].id = (int)i;
+        memset(recs[i].payload, (int)(i & 0xFF), sizeof(recs[i].payload));
+    }
+    return recs;
+}
+
+/*
+    checkResult()
+    -------------
+    Keys must equal `expected`; for the indirect sorts (stable) equal keys
+    must also keep increasing ids, and each payload must still belong to
+    its record.
+*/
+template <class Rec>
+static bool checkResult(const vector<Rec>& recs, const vector<int>& expected, bool stable)
+{
+    if (recs.size() != expected.size()) return false;
+    for (size_t i = 0; i < recs.size(); i++) {
+        if (recs[i].key != expected[i]) return false;
+        if (recs[i].payload[0] != (char)(recs[i].id & 0xFF)) return false;
+        if (stable && i > 0 && recs[i].key == recs[i - 1].key &&
+            recs[i].id < recs[i - 1].id) return false;
+    }
+    return true;
+}
+
+template <class Rec, class SortFn>
+static double timeSort(const vector<Rec>& input, const vector<int>& expected,
+                       bool stable, int reps, SortFn sortFn, bool& ok)
+{
+    double totalMs = 0.0;
+    for (int r = 0; r < reps; r++) {
+        vector<Rec> recs = input;
+        auto t0 = chrono::steady_clock::now();
+        sortFn(recs);
+        auto t1 = chrono::steady_clock::now();
+        totalMs += chrono::duration<double, milli>(t1 - t0).count();
+        ok &= checkResult(recs, expected, stable);
+    }
+    return totalMs / reps;
+}
+
+template <size_t Bytes>
+static bool runSize(const vector<int>& keys, const vector<int>& expected, int reps)
+{
+    typedef Record<Bytes> Rec;
+    vector<Rec> input = makeRecords<Rec>(keys);
+    bool ok = true;
+
+    double directMs = timeSort(input, expected, false, reps, [](vector<Rec>& recs) {
+        sort(recs.begin(), recs.end(), [](const Rec& a, const Rec& b) { return a.key < b.key; });
+    }, ok);
+
+    double gatherMs = timeSort(input, expected, true, reps, [](vector<Rec>& recs) {
+        vector<uint32_t> perm = sortedPermutation(recs);
+        applyGather(recs, perm);
+    }, ok);
+
+    double cycleMs = timeSort(input, expected, true, reps, [](vector<Rec>& recs) {
+        vector<uint32_t> perm = sortedPermutation(recs);
+        applyCycles(recs, perm);
+    }, ok);
+
+    cout << setw(8) << Bytes << " B"
+         << setw(14) << directMs
+         << setw(16) << gatherMs
+         << setw(16) << cycleMs
+         << setw(10) << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+static bool runAllSizes(const string& title, const vector<int>& keys,
+                        const vector<int>& expected, int reps)
+{
+    cout << "\n--- " << title << " (n = " << keys.size() << ", avg of "
+         << reps << " runs, ms) ---\n";
+    cout << setw(10) << "record" << setw(14) << "direct"
+         << setw(16) << "key+gather" << setw(16) << "key+cycles"
+         << setw(10) << "check" << "\n";
+    cout << fixed << setprecision(2);
+
+    bool ok = true;
+    ok &= runSize<64>(keys, expected, reps);
+    ok &= runSize<128>(keys, expected, reps);
+    ok &= runSize<256>(keys, expected, reps);
+    return ok;
+}
+
+int main()
+{
+    vector<int> unordered = loadFile("unordered.txt");
+    vector<int> expected  = loadFile("ordered.txt");
+
+    if (unordered.size() != expected.size()) {
+        cout << "File lengths differ! unordered=" << unordered.size()
+             << ", ordered=" << expected.size() << "\n";
+        return 1;
+    }
+
+    bool ok = runAllSizes("unordered.txt keys", unordered, expected, 20);
+
+    // Larger input: unordered.txt repeated with a different offset per copy
+    vector<int> big(LARGE_N);
+    for (size_t i = 0; i < LARGE_N; i++) {
+        big[i] = unordered[i % unordered.size()] + (int)(i / unordered.size()) * 7919;
+    }
+    vector<int> bigExpected = big;
+    sort(bigExpected.begin(), bigExpected.end());
+    ok &= runAllSizes("generated keys", big, bigExpected, 3);
+
+    cout << "\n" << (ok ? "SUCCESS — all outputs sorted correctly!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,318 @@
+/*
+    eytzinger_search.cpp
+    --------------------
+    Binary search over the same sorted data stored in EYTZINGER (BFS) order:
+    branch-free descent plus prefetching, compared with binarySearch() from
+    example 2.
+
+    WHY binarySearch() GETS SLOW
+    ----------------------------
+    1) `if (arr[mid] < target)` is a coin flip for random targets: about
+       half of the ~log2(n) branches per lookup are mispredicted.
+    2) The probes jump n/4, n/8, ... elements apart, so once the array is
+       bigger than the caches every step is a new cache miss, and the CPU
+       cannot start it early: WHERE to look next depends on the comparison
+       it just made.
+
+    EYTZINGER LAYOUT
+    ----------------
+    Store the sorted values as an implicit binary search tree in breadth-
+    first order, like a binary heap (1-based):
+
+        slot 1 = root (the median), children of slot k are 2k and 2k + 1
+
+        sorted: 1 2 3 4 5 6 7          eytzinger: _ 4 2 6 1 3 5 7
+                                                    ^ slot 0 unused
+
+    Built by an in-order walk of the slots (in-order of a BST = sorted).
+
+    SEARCH
+    ------
+        k = 1
+        while (k <= n) k = 2k + (b[k] < target)    // no if: compiles to setb/adc
+
+    The loop only computes an index, so there is nothing to mispredict but
+    the loop exit. When k falls off the tree, the answer is the last node
+    where we went LEFT: each right turn appended a 1 bit to k, so strip the
+    trailing 1s and one more bit:  k >>= ffs(~k).
+
+    PREFETCHING
+    -----------
+    The top levels share a few cache lines, and every level is stored
+    contiguously, so the 16 nodes 4 levels below slot k (16k .. 16k + 15)
+    fill ONE 64-byte line if slot 0 sits on a line boundary. Prefetching
+    that line at every step means the memory for level d + 4 is already on
+    its way while we compare at level d - about 4 misses in flight instead
+    of 1. (Prefetching just the grandchildren, 2 levels ahead, is too
+    little time for a DRAM miss.) Prefetches past the end of the array are
+    harmless hints.
+
+    COST
+    ----
+    Same number of comparisons (~log2 n). One extra array: rank[k] maps a
+    slot back to its index in the sorted array, so eytzingerSearch()
+    returns the same index binarySearch() would.
+
+    MEASURED
+    --------
+    1) Every value of ordered.txt and every gap between them: same answers
+       as binarySearch() and std::lower_bound.
+    2) Lookups per second for 2^20 random queries (half present), sizes
+       10^4 .. maxN: binarySearch(), Eytzinger without and with prefetch.
+
+    USAGE
+    -----
+        eytzinger_search [maxN]     (default 10^8; 10^9 needs ~12 GB of RAM)
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+
+#include "../common/fast_loader.hpp"
+
+// binarySearch() from example 2, for the comparison (its main() is left out)
+#ifdef SECTION12_NO_MAIN
+    #include "../example_2_binary_search/binary_search.cpp"
+#else
+    #define SECTION12_NO_MAIN
+    #include "../example_2_binary_search/binary_search.cpp"
+    #undef SECTION12_NO_MAIN
+#endif
+
+// Prefetch hint where the compiler has one; elsewhere it compiles away
+#ifndef EYTZINGER_PREFETCH
+    #if defined(__GNUC__) || defined(__clang__)
+        #define EYTZINGER_PREFETCH(addr) __builtin_prefetch(addr)
+    #else
+        #define EYTZINGER_PREFETCH(addr) ((void)0)
+    #endif
+#endif
+
+using namespace std;
+
+static const size_t LINE_INTS = 64 / sizeof(int);  // ints per cache line
+
+// ------------------------------------------------------------
+// Layout
+// ------------------------------------------------------------
+struct Eytzinger {
+    vector<int> storage;   // slots 0..n plus room to align slot 0 to 64 bytes
+    size_t offset = 0;     // storage[offset] is slot 0
+    vector<int> rank;      // rank[k] = index of slot k's value in the sorted array
+    size_t n = 0;
+
+    const int* slots() const { return storage.data() + offset; }
+    int* slots() { return storage.data() + offset; }
+};
+
+// In-order walk of the implicit tree: hands out sorted[i], i = 0, 1, ...
+static size_t eytzingerFill(Eytzinger& e, const vector<int>& sorted, size_t i, size_t k)
+{
+    if (k <= e.n) {
+        i = eytzingerFill(e, sorted, i, 2 * k);
+        e.slots()[k] = sorted[i];
+        e.rank[k] = (int)i;
+        i++;
+        i = eytzingerFill(e, sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+/*
+    buildEytzinger()
+    ----------------
+    Builds the layout from a sorted vector. O(n) time.
+*/
+static Eytzinger buildEytzinger(const vector<int>& sorted)
+{
+    Eytzinger e;
+    e.n = sorted.size();
+    e.storage.assign(e.n + 1 + LINE_INTS, 0);
+    e.rank.assign(e.n + 1, -1);
+
+    uintptr_t addr = (uintptr_t)e.storage.data();
+    e.offset = ((64 - addr % 64) % 64) / sizeof(int);
+
+    eytzingerFill(e, sorted, 0, 1);
+    return e;
+}
+
+// ------------------------------------------------------------
+// Search
+// ------------------------------------------------------------
+/*
+    undoRightTurns()
+    ----------------
+    k >> (number of trailing 1 bits + 1): climbs back past the final run of
+    right turns (and the left turn before it) of a descent.
+*/
+static inline size_t undoRightTurns(size_t k)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return k >> __builtin_ffsll((long long)~k);
+#else
+    while (k & 1) k >>= 1;
+    return k >> 1;
+#endif
+}
+
+/*
+    eytzingerLowerBoundSlot()
+    -------------------------
+    Slot of the first value >= target, or 0 if every value is smaller.
+*/
+template <bool Prefetch>
+static inline size_t eytzingerLowerBoundSlot(const Eytzinger& e, int target)
+{
+    const int* b = e.slots();
+    size_t k = 1;
+    while (k <= e.n) {
+        if (Prefetch) {
+            // &b[16k], computed as an integer: it may lie past the array
+            EYTZINGER_PREFETCH((const void*)((uintptr_t)b + k * LINE_INTS * sizeof(int)));
+        }
+        k = 2 * k + (b[k] < target);
+    }
+    return undoRightTurns(k);
+}
+
+/*
+    eytzingerSearch()
+    -----------------
+    Index of target in the original sorted array, or -1 - the same answer
+    as binarySearch().
+*/
+template <bool Prefetch = true>
+static inline int eytzingerSearch(const Eytzinger& e, int target)
+{
+    size_t k = eytzingerLowerBoundSlot<Prefetch>(e, target);
+    return (k != 0 && e.slots()[k] == target) ? e.rank[k] : -1;
+}
+
+/*
+    eytzingerLowerBound()
+    ---------------------
+    Index of the first value >= target in the sorted array (n if none),
+    like std::lower_bound.
+*/
+static inline size_t eytzingerLowerBound(const Eytzinger& e, int target)
+{
+    size_t k = eytzingerLowerBoundSlot<true>(e, target);
+    return k != 0 ? (size_t)e.rank[k] : e.n;
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        string full = string(prefixes[i]) + filename;
+        vector<int> arr;
+        if (loadIntsFast(full, arr)) {
+            cout << "Loaded: " << full << "\n";
+            return arr;
+        }
+    }
+
+    cout << "Error reading: " << filename << "\n";
+    cout << "Missing input file — aborting.\n";
+    exit(1);
+}
+
+#ifndef SECTION12_NO_MAIN  // veb_search.cpp includes this file without the tests and main()
+// ------------------------------------------------------------
+// Tests and measurements
+// ------------------------------------------------------------
+// Every value and every gap between values: same answers as binarySearch()
+static bool checkAgainstBinarySearch(const vector<int>& sorted, const Eytzinger& e)
+{
+    if (sorted.empty()) return true;
+    for (long long x = (long long)sorted.front() - 1; x <= (long long)sorted.back() + 1; x++) {
+        int target = (int)x;
+        if (eytzingerSearch(e, target) != binarySearch(sorted, target)) return false;
+        if (eytzingerSearch<false>(e, target) != binarySearch(sorted, target)) return false;
+        size_t expected = lower_bound(sorted.begin(), sorted.end(), target) - sorted.begin();
+        if (eytzingerLowerBound(e, target) != expected) return false;
+    }
+    return true;
+}
+
+// Runs search(q) over all queries; returns lookups per second
+template <class SearchFn>
+static double lookupsPerSecond(const vector<int>& queries, SearchFn search, long long& checksum)
+{
+    checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int q : queries) checksum += search(q);
+    auto t1 = chrono::steady_clock::now();
+    return queries.size() / chrono::duration<double>(t1 - t0).count();
+}
+
+static bool measureSize(size_t n, mt19937_64& rng)
+{
+    // Distinct even keys 0, 2, 4, ...; queries in [0, 2n): half are present
+    vector<int> sorted(n);
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)(2 * i);
+    Eytzinger e = buildEytzinger(sorted);
+
+    vector<int> queries(1 << 20);
+    for (int& q : queries) q = (int)(rng() % (2 * n));
+
+    long long sumBinary, sumPlain, sumPrefetch;
+    double binary   = lookupsPerSecond(queries, [&](int q) { return binarySearch(sorted, q); }, sumBinary);
+    double plain    = lookupsPerSecond(queries, [&](int q) { return eytzingerSearch<false>(e, q); }, sumPlain);
+    double prefetch = lookupsPerSecond(queries, [&](int q) { return eytzingerSearch<true>(e, q); }, sumPrefetch);
+
+    bool ok = (sumBinary == sumPlain) && (sumBinary == sumPrefetch);
+    cout << setw(12) << n
+         << setw(14) << binary / 1e6
+         << setw(14) << plain / 1e6
+         << setw(14) << prefetch / 1e6
+         << setw(10) << prefetch / binary << "x"
+         << setw(8) << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000000;
+
+    vector<int> sorted = loadFile("ordered.txt");
+    Eytzinger e = buildEytzinger(sorted);
+
+    cout << "\n=== Eytzinger Search Tests ===\n";
+    cout << "Loaded " << sorted.size() << " integers\n";
+    cout << "First slots (root, children, grandchildren):";
+    for (size_t k = 1; k <= 7 && k <= e.n; k++) cout << " " << e.slots()[k];
+    cout << "\n";
+
+    bool ok = checkAgainstBinarySearch(sorted, e);
+    cout << "All values and gaps vs binarySearch / lower_bound: "
+         << (ok ? "PASS" : "FAIL") << "\n";
+
+    cout << "\n--- Million lookups per second (2^20 random queries, half present) ---\n";
+    cout << setw(12) << "n" << setw(14) << "binarySearch" << setw(14) << "eytzinger"
+         << setw(14) << "+prefetch" << setw(11) << "speedup" << setw(8) << "check" << "\n";
+    cout << fixed << setprecision(2);
+
+    mt19937_64 rng(2024);
+    for (size_t n = 10000; n <= maxN; n *= 10) {
+        ok &= measureSize(n, rng);
+        if (n > SIZE_MAX / 10) break;
+    }
+
+    cout << "\n" << (ok ? "SUCCESS — all searches agree!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
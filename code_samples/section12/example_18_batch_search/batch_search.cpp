@@ -0,0 +1,348 @@
+/*
+    batch_search.cpp
+    ----------------
+    searchBatch(arr, targets, out): many binary searches on one sorted array
+    at once, compared with calling binarySearch() (example 2) in a loop.
+
+    WHY A LOOP OF binarySearch() IS SLOW
+    ------------------------------------
+    Each lookup is a chain: probe, compare, pick the next probe. On a large
+    array every probe is a cache miss, and the next one cannot start before
+    it returns - the CPU sits idle ~100 ns per step even though it could
+    have 10+ misses in flight. Different targets do not depend on each
+    other, though, so we can run several searches side by side.
+
+    INTERLEAVED SEARCH (scalar)
+    ---------------------------
+    Branch-free lower bound: with a fixed array size, every search makes
+    exactly the same number of steps with the same step sizes:
+
+        base = 0, len = n
+        while (len > 1):
+            half = len / 2
+            base += (arr[base + half] < target) ? half : 0    // cmov, no branch
+            len  -= half
+        position = base + (arr[base] < target)
+
+    So BATCH_LANES searches can advance IN LOCKSTEP: one step for lane 0,
+    one for lane 1, ..., then the next step. Their loads are independent,
+    so the CPU overlaps their cache misses.
+
+    AVX2 GATHER (x86, detected at runtime)
+    --------------------------------------
+    The same loop on 8 targets per register: _mm256_i32gather_epi32 loads
+    arr[base + half] for 8 lanes, _mm256_cmpgt_epi32 compares, and the
+    mask selects which lanes add `half`. GATHER_REGS registers (32 targets)
+    are interleaved to keep even more misses in flight.
+
+    Both return exactly what binarySearch() returns: the index of the
+    target, or -1 (values in arr are distinct, as in ordered.txt).
+
+    searchBatchParallel() splits the targets into one chunk per thread and
+    runs searchBatch() on each.
+
+    MEASURED
+    --------
+    1) Every value of ordered.txt and every gap: same answers as
+       binarySearch(), for every path.
+    2) Million lookups per second, 2^20 random targets (half present),
+       sizes 10^4 .. maxN.
+
+    USAGE
+    -----
+        batch_search [maxN]     (default 10^8)
+
+    BUILD
+    -----
+        g++ -std=c++17 -O2 -pthread batch_search.cpp -o batch_search
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+#include "../common/fast_loader.hpp"
+#include "../common/sorting_networks.hpp"  // detectSimdLevel(), SORTNET_AVX2
+
+// binarySearch() from example 2, for the comparison (its main() is left out)
+#ifdef SECTION12_NO_MAIN
+    #include "../example_2_binary_search/binary_search.cpp"
+#else
+    #define SECTION12_NO_MAIN
+    #include "../example_2_binary_search/binary_search.cpp"
+    #undef SECTION12_NO_MAIN
+#endif
+
+using namespace std;
+
+static const int BATCH_LANES = 16;  // scalar searches advanced in lockstep
+static const int GATHER_REGS = 4;   // AVX2 registers of 8 targets in lockstep
+
+// ------------------------------------------------------------
+// Scalar interleaved search
+// ------------------------------------------------------------
+/*
+    searchGroupScalar()
+    -------------------
+    Up to BATCH_LANES searches in lockstep; out[j] = index of t[j] or -1.
+*/
+static void searchGroupScalar(const int* a, size_t n, const int* t, int* out, int lanes)
+{
+    size_t base[BATCH_LANES] = { 0 };
+
+    for (size_t len = n; len > 1; ) {
+        size_t half = len / 2;
+        for (int j = 0; j < lanes; j++) {
+            base[j] = (a[base[j] + half] < t[j]) ? base[j] + half : base[j];
+        }
+        len -= half;
+    }
+
+    for (int j = 0; j < lanes; j++) {
+        size_t pos = base[j] + (a[base[j]] < t[j]);
+        out[j] = (pos < n && a[pos] == t[j]) ? (int)pos : -1;
+    }
+}
+
+static void searchRangeScalar(const int* a, size_t n, const int* t, int* out, size_t m)
+{
+    for (size_t start = 0; start < m; start += BATCH_LANES) {
+        int lanes = (int)min<size_t>(BATCH_LANES, m - start);
+        searchGroupScalar(a, n, t + start, out + start, lanes);
+    }
+}
+
+// ------------------------------------------------------------
+// AVX2 gather search
+// ------------------------------------------------------------
+#if SORTNET_X86
+/*
+    searchRangeAVX2()
+    -----------------
+    GATHER_REGS * 8 searches in lockstep with 32-bit gathers; the last
+    partial group goes through the scalar code. Needs n < 2^31.
+*/
+SORTNET_AVX2 static void searchRangeAVX2(const int* a, size_t n, const int* t, int* out, size_t m)
+{
+    const size_t group = GATHER_REGS * 8;
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i last = _mm256_set1_epi32((int)n - 1);
+    const __m256i size = _mm256_set1_epi32((int)n);
+    const __m256i notFound = _mm256_set1_epi32(-1);
+
+    size_t start = 0;
+    for (; start + group <= m; start += group) {
+        __m256i target[GATHER_REGS], base[GATHER_REGS];
+        for (int r = 0; r < GATHER_REGS; r++) {
+            target[r] = _mm256_loadu_si256((const __m256i*)(t + start + 8 * r));
+            base[r] = _mm256_setzero_si256();
+        }
+
+        for (size_t len = n; len > 1; ) {
+            size_t half = len / 2;
+            __m256i step = _mm256_set1_epi32((int)half);
+            for (int r = 0; r < GATHER_REGS; r++) {
+                __m256i probe = _mm256_add_epi32(base[r], step);
+                __m256i value = _mm256_i32gather_epi32(a, probe, 4);
+                __m256i less  = _mm256_cmpgt_epi32(target[r], value);  // value < target
+                base[r] = _mm256_add_epi32(base[r], _mm256_and_si256(less, step));
+            }
+            len -= half;
+        }
+
+        for (int r = 0; r < GATHER_REGS; r++) {
+            __m256i value = _mm256_i32gather_epi32(a, base[r], 4);
+            __m256i less  = _mm256_cmpgt_epi32(target[r], value);
+            __m256i pos   = _mm256_add_epi32(base[r], _mm256_and_si256(less, one));
+
+            // pos may be n (target above every value): clamp the load, mask the answer
+            __m256i found = _mm256_i32gather_epi32(a, _mm256_min_epi32(pos, last), 4);
+            __m256i hit = _mm256_and_si256(_mm256_cmpeq_epi32(found, target[r]),
+                                           _mm256_cmpgt_epi32(size, pos));
+            __m256i answer = _mm256_blendv_epi8(notFound, pos, hit);
+            _mm256_storeu_si256((__m256i*)(out + start + 8 * r), answer);
+        }
+    }
+
+    searchRangeScalar(a, n, t + start, out + start, m - start);
+}
+#endif
+
+// ------------------------------------------------------------
+// Public API
+// ------------------------------------------------------------
+/*
+    searchBatch()
+    -------------
+    out[i] = index of targets[i] in the sorted array arr, or -1.
+    Uses AVX2 gathers when the CPU has them (unless useSimd is false).
+*/
+void searchBatch(const vector<int>& arr, const vector<int>& targets, vector<int>& out,
+                 bool useSimd = true)
+{
+    out.resize(targets.size());
+    if (arr.empty()) {
+        fill(out.begin(), out.end(), -1);
+        return;
+    }
+
+#if SORTNET_X86
+    if (useSimd && detectSimdLevel() >= SimdLevel::AVX2 && arr.size() < (size_t)INT_MAX) {
+        searchRangeAVX2(arr.data(), arr.size(), targets.data(), out.data(), targets.size());
+        return;
+    }
+#endif
+    (void)useSimd;
+    searchRangeScalar(arr.data(), arr.size(), targets.data(), out.data(), targets.size());
+}
+
+/*
+    searchBatchParallel()
+    ---------------------
+    searchBatch() on `threads` contiguous chunks of targets at once.
+*/
+void searchBatchParallel(const vector<int>& arr, const vector<int>& targets, vector<int>& out,
+                         unsigned threads)
+{
+    out.resize(targets.size());
+    if (threads < 2 || targets.size() < 2 * (size_t)threads) {
+        searchBatch(arr, targets, out);
+        return;
+    }
+
+    size_t chunk = (targets.size() + threads - 1) / threads;
+    vector<thread> workers;
+    for (unsigned w = 0; w < threads; w++) {
+        size_t begin = w * chunk;
+        size_t end = min(targets.size(), begin + chunk);
+        if (begin >= end) break;
+        workers.emplace_back([&arr, &targets, &out, begin, end] {
+            vector<int> part(targets.begin() + begin, targets.begin() + end);
+            vector<int> answers;
+            searchBatch(arr, part, answers);
+            copy(answers.begin(), answers.end(), out.begin() + begin);
+        });
+    }
+    for (thread& w : workers) w.join();
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        string full = string(prefixes[i]) + filename;
+        vector<int> arr;
+        if (loadIntsFast(full, arr)) {
+            cout << "Loaded: " << full << "\n";
+            return arr;
+        }
+    }
+
+    cout << "Error reading: " << filename << "\n";
+    cout << "Missing input file — aborting.\n";
+    exit(1);
+}
+
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without the tests and main()
+// ------------------------------------------------------------
+// Tests and measurements
+// ------------------------------------------------------------
+static bool checkAgainstBinarySearch(const vector<int>& sorted)
+{
+    if (sorted.empty()) return true;
+
+    vector<int> targets;
+    for (long long x = (long long)sorted.front() - 1; x <= (long long)sorted.back() + 1; x++) {
+        targets.push_back((int)x);
+    }
+
+    vector<int> scalar, simd, parallel;
+    searchBatch(sorted, targets, scalar, false);
+    searchBatch(sorted, targets, simd, true);
+    searchBatchParallel(sorted, targets, parallel, 4);
+
+    for (size_t i = 0; i < targets.size(); i++) {
+        int expected = binarySearch(sorted, targets[i]);
+        if (scalar[i] != expected || simd[i] != expected || parallel[i] != expected) return false;
+    }
+    return true;
+}
+
+template <class RunFn>
+static double lookupsPerSecond(size_t queries, RunFn run)
+{
+    auto t0 = chrono::steady_clock::now();
+    run();
+    auto t1 = chrono::steady_clock::now();
+    return queries / chrono::duration<double>(t1 - t0).count();
+}
+
+static bool measureSize(size_t n, unsigned threads, mt19937_64& rng)
+{
+    // Distinct even keys; targets in [0, 2n): half are present
+    vector<int> sorted(n);
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)(2 * i);
+
+    vector<int> targets(1 << 20);
+    for (int& q : targets) q = (int)(rng() % (2 * n));
+
+    vector<int> loop(targets.size()), scalar, simd, parallel;
+    double loopRate = lookupsPerSecond(targets.size(), [&] {
+        for (size_t i = 0; i < targets.size(); i++) loop[i] = binarySearch(sorted, targets[i]);
+    });
+    double scalarRate = lookupsPerSecond(targets.size(), [&] { searchBatch(sorted, targets, scalar, false); });
+    double simdRate   = lookupsPerSecond(targets.size(), [&] { searchBatch(sorted, targets, simd, true); });
+    double parRate    = lookupsPerSecond(targets.size(), [&] { searchBatchParallel(sorted, targets, parallel, threads); });
+
+    bool ok = (loop == scalar) && (loop == simd) && (loop == parallel);
+    cout << setw(12) << n
+         << setw(14) << loopRate / 1e6
+         << setw(14) << scalarRate / 1e6
+         << setw(14) << simdRate / 1e6
+         << setw(14) << parRate / 1e6
+         << setw(8) << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000000;
+    unsigned threads = max(1u, thread::hardware_concurrency());
+
+    vector<int> sorted = loadFile("ordered.txt");
+
+    cout << "\n=== Batch Search Tests ===\n";
+    cout << "Loaded " << sorted.size() << " integers\n";
+    cout << "SIMD: " << simdLevelName(detectSimdLevel()) << " (gathers need AVX2), threads: "
+         << threads << "\n";
+
+    bool ok = checkAgainstBinarySearch(sorted);
+    cout << "All values and gaps vs binarySearch: " << (ok ? "PASS" : "FAIL") << "\n";
+
+    cout << "\n--- Million lookups per second (2^20 random targets, half present) ---\n";
+    cout << setw(12) << "n" << setw(14) << "binarySearch" << setw(14) << "batch scalar"
+         << setw(14) << "batch AVX2" << setw(14) << "AVX2 x thr" << setw(8) << "check" << "\n";
+    cout << fixed << setprecision(2);
+
+    mt19937_64 rng(7);
+    for (size_t n = 10000; n <= maxN; n *= 10) {
+        ok &= measureSize(n, threads, rng);
+        if (n > SIZE_MAX / 10) break;
+    }
+
+    cout << "\n" << (ok ? "SUCCESS — all searches agree!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
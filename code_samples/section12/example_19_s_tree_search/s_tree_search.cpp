@@ -0,0 +1,399 @@
+/*
+    s_tree_search.cpp
+    -----------------
+    Static B-tree ("S-tree") index over a sorted array: 16 keys per node,
+    one cache line each, searched with SIMD compares. Compared with
+    binarySearch() (example 2) and jumpSearch() (example 3).
+
+    IDEA
+    ----
+    binarySearch() learns 1 bit per cache miss: each probe halves the range.
+    A cache line holds 16 ints, so if the 16 keys we look at next were in
+    ONE line, one miss would choose among 17 ranges (~4 bits). That is a
+    B-tree with B = 16, stored implicitly (no pointers), like a heap:
+
+        node k holds keys[16k .. 16k + 15]        (64-byte aligned)
+        child i of node k (i = 0..16) is node k * 17 + i + 1
+
+    Depth is log17(n) instead of log2(n): 10^6 keys = 5 node visits
+    instead of 20 probes. jumpSearch()'s sqrt(n) blocks are the same idea
+    taken the wrong way: a single level of huge blocks, scanned linearly.
+
+    BUILDING
+    --------
+    An in-order walk over the implicit tree hands out the sorted values one
+    by one (like the Eytzinger build in example 17). The last node is padded
+    with INT_MAX; padding always comes after every real key in order, so it
+    is only ever the answer when nothing real is >= target. rank[slot] maps
+    each slot back to its index in the sorted array (n for padding).
+
+    SEARCH (lower bound)
+    --------------------
+        k = 0
+        while (k < blocks):
+            i = number of keys in node k that are < target      (0..16)
+            if i < 16: candidate = slot 16k + i                 (cmov)
+            k = child i of node k
+
+    Keys in a node are sorted, so "keys < target" is always a prefix and its
+    length IS the position. With AVX2 the 16 comparisons are 2 instructions:
+
+        lt   = _mm256_cmpgt_epi32(target, keys)     x2 (8 keys each)
+        mask = movemask(lt0) | movemask(lt1) << 8   16 bits, 1 = key < target
+        i    = ctz(~mask)                           length of the prefix
+
+    Without AVX2 the same count is a plain 16-iteration loop with no
+    branches (the compiler vectorizes it with SSE2).
+
+    API
+    ---
+        STree t = buildSTree(sorted);
+        streeFind(t, x)        index of x in sorted, or -1  (= binarySearch)
+        streeLowerBound(t, x)  index of the first value >= x, n if none
+
+    USAGE
+    -----
+        s_tree_search [maxN]     (default 10^8)
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+
+#include "../common/fast_loader.hpp"
+#include "../common/sorting_networks.hpp"  // detectSimdLevel(), SORTNET_AVX2
+
+// binarySearch() (example 2) and jumpSearch() (example 3) for the comparison,
+// each in its own namespace because both files define a loader; their
+// main() functions are left out
+#ifndef SECTION12_NO_MAIN
+    #define SECTION12_NO_MAIN
+    #define S_TREE_DEFINED_NO_MAIN
+#endif
+namespace ex2 {
+#include "../example_2_binary_search/binary_search.cpp"
+}
+namespace ex3 {
+#include "../example_3_jump_search/jump_search.cpp"
+}
+#ifdef S_TREE_DEFINED_NO_MAIN
+    #undef SECTION12_NO_MAIN
+    #undef S_TREE_DEFINED_NO_MAIN
+#endif
+
+using namespace std;
+
+static const int    NODE_KEYS  = 16;          // keys per node = one 64-byte line
+static const size_t NO_SLOT    = SIZE_MAX;    // lower bound past every key
+static const size_t JUMP_MAX_N = 1000000;     // jumpSearch is O(sqrt n) per lookup
+
+// ------------------------------------------------------------
+// Layout
+// ------------------------------------------------------------
+struct STree {
+    vector<int> storage;   // blocks * 16 keys plus room to align node 0
+    size_t offset = 0;     // storage[offset] is key 0 of node 0
+    vector<int> rank;      // rank[slot] = index in the sorted array (n = padding)
+    size_t n = 0;
+    size_t blocks = 0;
+
+    const int* node(size_t k) const { return storage.data() + offset + k * NODE_KEYS; }
+    int* node(size_t k) { return storage.data() + offset + k * NODE_KEYS; }
+};
+
+static inline size_t streeChild(size_t k, int i)
+{
+    return k * (NODE_KEYS + 1) + i + 1;
+}
+
+// In-order walk: key i of node k comes after everything in child i
+static size_t streeFill(STree& t, const vector<int>& sorted, size_t next, size_t k)
+{
+    if (k >= t.blocks) return next;
+
+    for (int i = 0; i < NODE_KEYS; i++) {
+        next = streeFill(t, sorted, next, streeChild(k, i));
+        size_t slot = k * NODE_KEYS + i;
+        if (next < t.n) {
+            t.node(k)[i] = sorted[next];
+            t.rank[slot] = (int)next;
+            next++;
+        } else {
+            t.node(k)[i] = INT_MAX;
+            t.rank[slot] = (int)t.n;
+        }
+    }
+    return streeFill(t, sorted, next, streeChild(k, NODE_KEYS));
+}
+
+/*
+    buildSTree()
+    ------------
+    Builds the index from a sorted vector. O(n) time, n/16 rounded up nodes.
+*/
+static STree buildSTree(const vector<int>& sorted)
+{
+    STree t;
+    t.n = sorted.size();
+    t.blocks = (t.n + NODE_KEYS - 1) / NODE_KEYS;
+    t.storage.assign(t.blocks * NODE_KEYS + NODE_KEYS, INT_MAX);
+    t.rank.assign(t.blocks * NODE_KEYS, (int)t.n);
+
+    uintptr_t addr = (uintptr_t)t.storage.data();
+    t.offset = ((64 - addr % 64) % 64) / sizeof(int);
+
+    streeFill(t, sorted, 0, 0);
+    return t;
+}
+
+// ------------------------------------------------------------
+// Search
+// ------------------------------------------------------------
+/*
+    streeLowerBoundSlotScalar()
+    ---------------------------
+    Slot of the first key >= target, or NO_SLOT.
+*/
+static inline size_t streeLowerBoundSlotScalar(const STree& t, int target)
+{
+    size_t k = 0;
+    size_t candidate = NO_SLOT;
+    while (k < t.blocks) {
+        const int* keys = t.node(k);
+        int i = 0;
+        for (int j = 0; j < NODE_KEYS; j++) i += (keys[j] < target);
+        candidate = (i < NODE_KEYS) ? k * NODE_KEYS + i : candidate;
+        k = streeChild(k, i);
+    }
+    return candidate;
+}
+
+#if SORTNET_X86
+SORTNET_AVX2 static inline size_t streeLowerBoundSlotAVX2(const STree& t, int target)
+{
+    const __m256i x = _mm256_set1_epi32(target);
+    size_t k = 0;
+    size_t candidate = NO_SLOT;
+    while (k < t.blocks) {
+        const int* keys = t.node(k);
+        __m256i lo = _mm256_load_si256((const __m256i*)keys);
+        __m256i hi = _mm256_load_si256((const __m256i*)(keys + 8));
+        unsigned less =
+            (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, lo))) |
+            ((unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, hi))) << 8);
+        int i = __builtin_ctz(~less);   // bit 16 of ~less is always set
+        candidate = (i < NODE_KEYS) ? k * NODE_KEYS + i : candidate;
+        k = streeChild(k, i);
+    }
+    return candidate;
+}
+#endif
+
+template <bool Simd>
+static inline size_t streeLowerBoundSlot(const STree& t, int target)
+{
+#if SORTNET_X86
+    if (Simd) return streeLowerBoundSlotAVX2(t, target);
+#endif
+    return streeLowerBoundSlotScalar(t, target);
+}
+
+static bool streeHasAVX2()
+{
+    return detectSimdLevel() >= SimdLevel::AVX2;
+}
+
+/*
+    streeFind()
+    -----------
+    Index of target in the sorted array, or -1 (same answer as binarySearch()).
+    Padding slots hold INT_MAX too, so a match only counts if its rank is a
+    real index (< n).
+*/
+template <bool Simd>
+static inline int streeFindWith(const STree& t, int target)
+{
+    size_t slot = streeLowerBoundSlot<Simd>(t, target);
+    return (slot != NO_SLOT && t.storage[t.offset + slot] == target &&
+            t.rank[slot] < (int)t.n) ? t.rank[slot] : -1;
+}
+
+static inline int streeFind(const STree& t, int target)
+{
+    return streeHasAVX2() ? streeFindWith<true>(t, target) : streeFindWith<false>(t, target);
+}
+
+/*
+    streeLowerBound()
+    -----------------
+    Index of the first value >= target in the sorted array (n if none),
+    like std::lower_bound.
+*/
+static inline size_t streeLowerBound(const STree& t, int target)
+{
+    size_t slot = streeHasAVX2() ? streeLowerBoundSlot<true>(t, target)
+                                 : streeLowerBoundSlot<false>(t, target);
+    return slot != NO_SLOT ? (size_t)t.rank[slot] : t.n;
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        string full = string(prefixes[i]) + filename;
+        vector<int> arr;
+        if (loadIntsFast(full, arr)) {
+            cout << "Loaded: " << full << "\n";
+            return arr;
+        }
+    }
+
+    cout << "Error reading: " << filename << "\n";
+    cout << "Missing input file — aborting.\n";
+    exit(1);
+}
+
+#ifndef SECTION12_NO_MAIN  // veb_search.cpp includes this file without the tests and main()
+// ------------------------------------------------------------
+// Tests and measurements
+// ------------------------------------------------------------
+static bool agreesAt(const vector<int>& sorted, const STree& t, int target)
+{
+    int expected = ex2::binarySearch(sorted, target);
+    if (streeFindWith<false>(t, target) != expected) return false;
+    if (streeHasAVX2() && streeFindWith<true>(t, target) != expected) return false;
+    size_t lb = lower_bound(sorted.begin(), sorted.end(), target) - sorted.begin();
+    return streeLowerBound(t, target) == lb;
+}
+
+// Every value and gap in [front - 1, back + 1], plus INT_MIN / INT_MAX
+// (INT_MAX is also the padding key)
+static bool checkAgainstBinarySearch(const vector<int>& sorted, const STree& t)
+{
+    if (!agreesAt(sorted, t, INT_MIN) || !agreesAt(sorted, t, INT_MAX)) return false;
+    if (sorted.empty()) return true;
+    for (long long x = (long long)sorted.front() - 1; x <= (long long)sorted.back() + 1; x++) {
+        if (!agreesAt(sorted, t, (int)x)) return false;
+    }
+    return true;
+}
+
+// Small trees (mostly padding): each key, its neighbours, INT_MIN / INT_MAX
+static bool checkSmallTrees()
+{
+    vector<vector<int>> smalls = { {}, { 1, 2, 3 }, { INT_MAX }, { INT_MIN, 0, INT_MAX } };
+    for (const vector<int>& sorted : smalls) {
+        STree t = buildSTree(sorted);
+        if (!agreesAt(sorted, t, INT_MIN) || !agreesAt(sorted, t, INT_MAX)) return false;
+        for (int key : sorted) {
+            if (!agreesAt(sorted, t, key)) return false;
+            if (key > INT_MIN && !agreesAt(sorted, t, key - 1)) return false;
+            if (key < INT_MAX && !agreesAt(sorted, t, key + 1)) return false;
+        }
+    }
+    return true;
+}
+
+template <class SearchFn>
+static double lookupsPerSecond(const vector<int>& queries, size_t count, SearchFn search,
+                               long long& checksum)
+{
+    checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (size_t q = 0; q < count; q++) checksum += search(queries[q]);
+    auto t1 = chrono::steady_clock::now();
+    return count / chrono::duration<double>(t1 - t0).count();
+}
+
+static bool measureSize(size_t n, mt19937_64& rng)
+{
+    // Distinct even keys; queries in [0, 2n): half are present
+    vector<int> sorted(n);
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)(2 * i);
+    STree t = buildSTree(sorted);
+
+    vector<int> queries(1 << 20);
+    for (int& q : queries) q = (int)(rng() % (2 * n));
+    size_t all = queries.size();
+    size_t few = 1 << 14;   // jumpSearch gets fewer queries (sqrt n steps each)
+
+    long long sumBinary, sumJump, sumJumpRef, sumScalar, sumSimd = 0;
+    double binary = lookupsPerSecond(queries, all, [&](int q) { return ex2::binarySearch(sorted, q); }, sumBinary);
+    double scalar = lookupsPerSecond(queries, all, [&](int q) { return streeFindWith<false>(t, q); }, sumScalar);
+    double simd = 0.0;
+    if (streeHasAVX2()) {
+        simd = lookupsPerSecond(queries, all, [&](int q) { return streeFindWith<true>(t, q); }, sumSimd);
+    } else {
+        sumSimd = sumScalar;
+    }
+
+    bool ok = (sumBinary == sumScalar) && (sumBinary == sumSimd);
+
+    cout << setw(12) << n << setw(14) << binary / 1e6;
+    if (n <= JUMP_MAX_N) {
+        double jump = lookupsPerSecond(queries, few, [&](int q) { return ex3::jumpSearch(sorted, q); }, sumJump);
+        lookupsPerSecond(queries, few, [&](int q) { return ex2::binarySearch(sorted, q); }, sumJumpRef);
+        ok &= (sumJump == sumJumpRef);
+        cout << setw(14) << jump / 1e6;
+    } else {
+        cout << setw(14) << "-";
+    }
+    cout << setw(14) << scalar / 1e6;
+    if (simd > 0) cout << setw(14) << simd / 1e6;
+    else          cout << setw(14) << "n/a";
+    cout << setw(8) << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000000;
+
+    vector<int> sorted = loadFile("ordered.txt");
+    STree t = buildSTree(sorted);
+
+    cout << "\n=== S-tree Search Tests ===\n";
+    cout << "Loaded " << sorted.size() << " integers into " << t.blocks << " nodes of "
+         << NODE_KEYS << " keys\n";
+    cout << "SIMD: " << simdLevelName(detectSimdLevel()) << "\n";
+
+    int depth = 0;
+    for (size_t k = 0; k < t.blocks; k = streeChild(k, 0)) depth++;
+    cout << "Tree depth: " << depth << " node visits (binary search: ~"
+         << (int)ceil(log2((double)sorted.size() + 1)) << " probes)\n";
+
+    bool ok = checkAgainstBinarySearch(sorted, t);
+    cout << "All values and gaps vs binarySearch / lower_bound: " << (ok ? "PASS" : "FAIL") << "\n";
+
+    bool smallOk = checkSmallTrees();
+    cout << "Small arrays incl. INT_MIN / INT_MAX keys: " << (smallOk ? "PASS" : "FAIL") << "\n";
+    ok &= smallOk;
+
+    cout << "\n--- Million lookups per second (random queries, half present) ---\n";
+    cout << setw(12) << "n" << setw(14) << "binarySearch" << setw(14) << "jumpSearch"
+         << setw(14) << "S-tree" << setw(14) << "S-tree AVX2" << setw(8) << "check" << "\n";
+    cout << fixed << setprecision(2);
+
+    mt19937_64 rng(99);
+    for (size_t n = 10000; n <= maxN; n *= 10) {
+        ok &= measureSize(n, rng);
+        if (n > SIZE_MAX / 10) break;
+    }
+
+    cout << "\n" << (ok ? "SUCCESS — all searches agree!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
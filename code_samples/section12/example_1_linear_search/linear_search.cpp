@@ -2,6 +2,13 @@
 #include <fstream>    // Provides file stream classes (ifstream)
 #include <vector>     // Provides the std::vector container
 #include <string>     // Provides the std::string class
+#include <thread>     // Provides std::thread for the parallel scan
+#include <atomic>     // Provides std::atomic (first hit shared by threads)
+#include <chrono>     // Provides timing for the scan comparison
+#include <algorithm>  // Provides std::min
+
+#include "../common/fast_loader.hpp"
+#include "../common/sorting_networks.hpp"  // detectSimdLevel(), SORTNET_AVX2
 
 using namespace std;  // Allows use of standard library names without std:: prefix
 
@@ -37,6 +44,160 @@ int linearSearchSteps(const vector<int>& arr, int target, long long& stepsOut) {
     return -1;                // Indicate unsuccessful search
 }
 
+// ===============================
+// SIMD Linear Search
+// ===============================
+//
+// linearSearchSteps() compares ONE int per iteration and also updates a
+// counter. A SIMD register compares many at once:
+//
+//   AVX2: 4 registers x 8 ints = 32 ints per iteration
+//   SSE2: 4 registers x 4 ints = 16 ints per iteration
+//
+// Each register compare gives a lane mask (all 1s where arr[i] == target).
+// The 4 masks are OR-ed and tested with ONE branch per iteration; only on a
+// hit are they turned into a bit mask (movemask, one bit per int) whose
+// lowest set bit (ctz) is the FIRST matching index. The last n % 32 (or 16)
+// ints are checked with a plain loop, so no read goes past the end.
+
+// Scalar fallback without the step counter
+static int linearScanScalar(const int* a, int n, int target) {
+    for (int i = 0; i < n; i++) {
+        if (a[i] == target) return i;
+    }
+    return -1;
+}
+
+#if SORTNET_X86
+// SSE2 is part of every x86-64 CPU: 16 ints per iteration
+static int linearScanSSE2(const int* a, int n, int target) {
+    const __m128i t = _mm_set1_epi32(target);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), t);
+        __m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 4)), t);
+        __m128i c2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 8)), t);
+        __m128i c3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 12)), t);
+        __m128i any = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+
+        if (_mm_movemask_epi8(any) != 0) {
+            // One bit per int, in array order
+            unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(c0))
+                          | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(c1)) << 4
+                          | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(c2)) << 8
+                          | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(c3)) << 12;
+            return i + __builtin_ctz(mask);
+        }
+    }
+    int rest = linearScanScalar(a + i, n - i, target);   // tail: n % 16 ints
+    return rest < 0 ? -1 : i + rest;
+}
+
+// AVX2: 32 ints per iteration
+SORTNET_AVX2 static int linearScanAVX2(const int* a, int n, int target) {
+    const __m256i t = _mm256_set1_epi32(target);
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), t);
+        __m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 8)), t);
+        __m256i c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 16)), t);
+        __m256i c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 24)), t);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+
+        if (!_mm256_testz_si256(any, any)) {
+            unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c0))
+                          | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c1)) << 8
+                          | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c2)) << 16
+                          | (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(c3)) << 24;
+            return i + __builtin_ctz(mask);
+        }
+    }
+    int rest = linearScanSSE2(a + i, n - i, target);     // tail: n % 32 ints
+    return rest < 0 ? -1 : i + rest;
+}
+#endif
+
+// Best scan for this CPU over a[0..n)
+static int linearScan(const int* a, int n, int target) {
+#if SORTNET_X86
+    if (detectSimdLevel() >= SimdLevel::AVX2) return linearScanAVX2(a, n, target);
+    return linearScanSSE2(a, n, target);
+#else
+    return linearScanScalar(a, n, target);
+#endif
+}
+
+/**
+ * SIMD linear search: same answer as linearSearchSteps() (the FIRST index
+ * holding target, or -1), without step counting.
+ *
+ * @param arr     Vector to search (any order)
+ * @param target  Value to search for
+ *
+ * @return Index of the first occurrence of target, otherwise -1
+ */
+int linearSearch(const vector<int>& arr, int target) {
+    return linearScan(arr.data(), (int)arr.size(), target);
+}
+
+// ===============================
+// Multi-threaded chunked scan
+// ===============================
+//
+// For very large arrays one core cannot use all the memory bandwidth.
+// linearSearchParallel() gives each thread one contiguous chunk and has
+// it scan in PARALLEL_BLOCK-int blocks with linearScan(). The first hit
+// is kept in an atomic (lowest index wins); before each block a thread
+// checks it and stops once a hit BEFORE its block is known, so the
+// answer is still the first occurrence and nobody scans far past it.
+
+static const int PARALLEL_MIN_N = 1 << 20;  // below this, threads cost more than they save
+static const int PARALLEL_BLOCK = 1 << 16;  // ints scanned between checks (256 KB)
+
+/**
+ * Multi-threaded SIMD linear search.
+ *
+ * @param arr      Vector to search (any order)
+ * @param target   Value to search for
+ * @param threads  Number of threads (0 = one per hardware thread)
+ *
+ * @return Index of the first occurrence of target, otherwise -1
+ */
+int linearSearchParallel(const vector<int>& arr, int target, unsigned threads = 0) {
+    int n = (int)arr.size();
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads < 2 || n < PARALLEL_MIN_N) return linearSearch(arr, target);
+
+    std::atomic<int> first(n);   // n = nothing found yet
+    int chunk = (int)((n + (long long)threads - 1) / threads);
+    vector<std::thread> workers;
+
+    for (unsigned w = 0; w < threads; w++) {
+        int begin = (int)std::min<long long>((long long)w * chunk, n);
+        int end = std::min(n, begin + chunk);
+        if (begin >= end) break;
+
+        workers.emplace_back([&arr, &first, begin, end, target] {
+            for (int block = begin; block < end; block += PARALLEL_BLOCK) {
+                if (first.load(std::memory_order_relaxed) < block) return;  // earlier hit exists
+
+                int len = std::min(PARALLEL_BLOCK, end - block);
+                int hit = linearScan(arr.data() + block, len, target);
+                if (hit >= 0) {
+                    int idx = block + hit;
+                    int seen = first.load();
+                    while (idx < seen && !first.compare_exchange_weak(seen, idx)) {}
+                    return;
+                }
+            }
+        });
+    }
+    for (std::thread& w : workers) w.join();
+
+    int idx = first.load();
+    return idx < n ? idx : -1;
+}
+
 // ===============================
 // Load integers from file
 // ===============================
@@ -50,24 +211,15 @@ int linearSearchSteps(const vector<int>& arr, int target, long long& stepsOut) {
  *         Returns an empty vector if the file cannot be opened.
  */
 vector<int> loadFile(const string& path) {
-    // Attempt to open the file for reading
-    ifstream f(path);
-
     vector<int> arr;  // Dynamic array to store integers from file
 
-    // Check for file open failure
-    if (!f.is_open()) {
+    // Read integers until EOF or invalid input in one bulk pass;
+    // false means the file could not be opened
+    if (!loadIntsFast(path, arr)) {
         cout << "Error: cannot open " << path << "\n";
         return {};    // Return empty vector on failure
     }
 
-    int x;  // Temporary variable to store each integer read
-
-    // Read integers until EOF or invalid input
-    while (f >> x) {
-        arr.push_back(x);  // Append each value to the vector
-    }
-
     // Vector is returned by value (move semantics apply)
     return arr;
 }
@@ -111,7 +263,59 @@ void runSearchTests(const string& name, const vector<int>& arr) {
     index = linearSearchSteps(arr, 999999, steps);
     cout << "Search missing element (999999)"
          << ": index=" << index
-         << ", steps=" << steps << "\n\n";
+         << ", steps=" << steps << "\n";
+
+    // The SIMD and parallel scans must agree with the counting version
+    // for every value in the file and for a missing one
+    bool agree = true;
+    for (size_t i = 0; i <= arr.size(); i++) {
+        int target = (i < arr.size()) ? arr[i] : 999999;
+        int expected = linearSearchSteps(arr, target, steps);
+        agree &= (linearSearch(arr, target) == expected);
+        agree &= (linearSearchParallel(arr, target, 4) == expected);
+    }
+    cout << "SIMD / parallel scan agree on every value: "
+         << (agree ? "PASS" : "FAIL") << "\n\n";
+}
+
+// ===============================
+// Scan speed comparison
+// ===============================
+
+/**
+ * Times a full scan (missing target) of an n-int array with each version
+ * and prints milliseconds and GB/s.
+ *
+ * @param n  Number of ints in the generated array
+ */
+void runScanTimings(int n) {
+    vector<int> arr(n);
+    for (int i = 0; i < n; i++) arr[i] = i;   // target -1 is never present
+
+    auto timeIt = [&](const char* name, int (*scan)(const vector<int>&, int)) {
+        auto t0 = std::chrono::steady_clock::now();
+        int idx = scan(arr, -1);
+        auto t1 = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        cout << "  " << name << ": " << ms << " ms, "
+             << (n * sizeof(int)) / (ms * 1e6) << " GB/s"
+             << (idx == -1 ? "" : "  (WRONG)") << "\n";
+    };
+
+    // Parallel scan with 4 threads (even on fewer cores): hits in every
+    // chunk, and a duplicate so only the FIRST occurrence is correct
+    bool agree = true;
+    for (int k : { 0, n / 8, n / 4 + 1, n / 2, 3 * (n / 4), n - 1 }) {
+        agree &= (linearSearchParallel(arr, k, 4) == k);
+    }
+    arr[n - 1] = n / 3;
+    agree &= (linearSearchParallel(arr, n / 3, 4) == n / 3);
+    arr[n - 1] = n - 1;
+
+    cout << "n = " << n << " (4-thread scan finds first hits: " << (agree ? "PASS" : "FAIL") << ")\n";
+    timeIt("linearSearchSteps   ", [](const vector<int>& a, int t) { long long s; return linearSearchSteps(a, t, s); });
+    timeIt("linearSearch (SIMD) ", [](const vector<int>& a, int t) { return linearSearch(a, t); });
+    timeIt("linearSearchParallel", [](const vector<int>& a, int t) { return linearSearchParallel(a, t); });
 }
 
 // ===============================
@@ -125,6 +329,7 @@ void runSearchTests(const string& name, const vector<int>& arr) {
  * runs linear search performance tests on each,
  * and reports comparison counts for different cases.
  */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // Load both test datasets from disk
     vector<int> ordered   = loadFile("..\\data\\ordered.txt");
@@ -140,5 +345,12 @@ int main() {
     runSearchTests("Ordered Data", ordered);
     runSearchTests("Unordered Data", unordered);
 
+    // Full-scan speed of the three versions on larger generated arrays
+    cout << "=== Scan Speed (SIMD: " << simdLevelName(detectSimdLevel())
+         << ", threads: " << std::max(1u, std::thread::hardware_concurrency()) << ") ===\n";
+    runScanTimings(1000000);
+    runScanTimings(10000000);
+
     return 0;  // Successful program termination
 }
+#endif // SECTION12_NO_MAIN
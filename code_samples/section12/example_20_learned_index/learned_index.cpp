@@ -0,0 +1,492 @@
+/*
+    learned_index.cpp
+    -----------------
+    Learned index search: piecewise linear models with a guaranteed error
+    bound (PGM-index style), compared with interpolationSearch() (example 4)
+    and binarySearch() (example 2) on uniform and skewed keys.
+
+    THE IDEA
+    --------
+    A sorted array is a function key -> position. interpolationSearch()
+    models it with ONE straight line from arr[lo] to arr[hi]. On uniform
+    keys the guess is close; on skewed keys (a few huge gaps, dense runs)
+    the line is far off and the search needs many probes - up to O(n).
+
+    A learned index fits MANY lines instead, each one only as long as it
+    stays within EPSILON positions of every key it covers:
+
+        segment = (first key, first position, slope)
+        guess   = position + slope * (target - first key)
+        answer  is within guess +- EPSILON  ->  binary search 2*EPSILON+1 slots
+
+    BUILDING A SEGMENT: THE SHRINKING CONE
+    --------------------------------------
+    Starting at point (k0, p0), a line with slope s keeps point (k, p)
+    within EPSILON iff
+
+        (p - p0 - EPSILON) / (k - k0)  <=  s  <=  (p - p0 + EPSILON) / (k - k0)
+
+    Walk the keys, intersecting these slope intervals. When the interval
+    becomes empty, close the segment (slope = middle of the last interval)
+    and start a new one. One pass, O(n), no fitting of any kind.
+
+    FINDING THE SEGMENT: RECURSION
+    ------------------------------
+    The segments' first keys are themselves a sorted array, so the same
+    construction is applied to THEM (with a small EPSILON_INNER), and again,
+    until at most TOP_SEGMENTS remain. A lookup then does, per level:
+    evaluate one line, binary search a tiny window. Levels are few (the
+    count shrinks ~100x per level).
+
+    COST
+    ----
+    Uniform keys need a handful of segments in total; skewed keys need more,
+    but every lookup stays O(levels * log2(EPSILON)) - no bad inputs.
+
+    DUPLICATE KEYS
+    --------------
+    The cone needs distinct keys: a run of equal keys is a vertical line
+    that no slope can follow within EPSILON. If the data has duplicates,
+    the levels are built over the DISTINCT values instead, and firstPos[]
+    maps each one back to its first occurrence - which is exactly the
+    lower bound. Without duplicates the data is modelled directly (no copy,
+    no extra lookup).
+
+    MEASURED
+    --------
+    1) Every value of ordered.txt and every gap: same answers as
+       binarySearch(). The same on keys with long runs of duplicates
+       (lower bound vs std::lower_bound).
+    2) Million lookups per second for uniform keys and for skewed keys
+       (Pareto-distributed gaps), sizes 10^4 .. maxN, plus the index size.
+
+    USAGE
+    -----
+        learned_index [maxN]     (default 10^7)
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+
+#include "../common/fast_loader.hpp"
+
+// binarySearch() (example 2) and interpolationSearch() (example 4) for the
+// comparison, each in its own namespace because both files define a
+// loader; their main() functions are left out. Only the tests use them, so
+// they are skipped when this file is itself included.
+#ifndef SECTION12_NO_MAIN
+    #define SECTION12_NO_MAIN
+namespace ex2 {
+#include "../example_2_binary_search/binary_search.cpp"
+}
+namespace ex4 {
+#include "../example_4_interpolation_search/interpolation_search.cpp"
+}
+    #undef SECTION12_NO_MAIN
+#endif
+
+using namespace std;
+
+static const int    EPSILON          = 64;      // max position error, data level
+static const int    EPSILON_INNER    = 4;       // max position error, upper levels
+static const size_t TOP_SEGMENTS     = 16;      // stop recursing at this many
+static const size_t INTERP_MAX_QUERY = 1 << 12; // interpolationSearch can be O(n)
+
+// ------------------------------------------------------------
+// Model
+// ------------------------------------------------------------
+struct Segment {
+    double slope;       // positions per key unit
+    int key;            // first key covered
+    uint32_t start;     // position of that key
+};
+
+struct Level {
+    vector<Segment> segments;
+    vector<int> firstKeys;   // segments[i].key - the "array" the level above models
+    int epsilon;
+};
+
+struct LearnedIndex {
+    const vector<int>* data = nullptr;   // the sorted array itself (not copied)
+    vector<int> distinct;                // distinct values - only if data has duplicates
+    vector<uint32_t> firstPos;           // firstPos[i] = first position of distinct[i] in data
+    vector<Level> levels;                // levels[0] models the keys, last = top
+
+    // The array levels[0] models: data itself, or its distinct values
+    const int* keys() const { return distinct.empty() ? data->data() : distinct.data(); }
+    size_t keyCount() const { return distinct.empty() ? data->size() : distinct.size(); }
+};
+
+/*
+    buildSegments()
+    ---------------
+    Shrinking-cone segmentation of keys[0..m) (sorted, distinct) with the
+    given maximum position error.
+*/
+static vector<Segment> buildSegments(const int* keys, size_t m, int epsilon)
+{
+    vector<Segment> segments;
+    size_t i = 0;
+    while (i < m) {
+        double lo = 0.0, hi = HUGE_VAL;
+        size_t j = i + 1;
+        for (; j < m; j++) {
+            double dx = (double)keys[j] - (double)keys[i];
+            double dy = (double)(j - i);
+            double newLo = max(lo, (dy - epsilon) / dx);
+            double newHi = min(hi, (dy + epsilon) / dx);
+            if (newLo > newHi) break;
+            lo = newLo;
+            hi = newHi;
+        }
+
+        Segment s;
+        s.slope = (hi == HUGE_VAL) ? 0.0 : (lo + hi) / 2;
+        s.key = keys[i];
+        s.start = (uint32_t)i;
+        segments.push_back(s);
+        i = j;
+    }
+    return segments;
+}
+
+/*
+    buildLearnedIndex()
+    -------------------
+    Level 0 over the data (or its distinct values, see DUPLICATE KEYS), then
+    levels over the segment keys until at most TOP_SEGMENTS remain. `sorted`
+    must stay alive (and unchanged) while the index is used.
+*/
+static LearnedIndex buildLearnedIndex(const vector<int>& sorted)
+{
+    LearnedIndex index;
+    index.data = &sorted;
+
+    if (adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+        for (size_t i = 0; i < sorted.size(); i++) {
+            if (i == 0 || sorted[i] != sorted[i - 1]) {
+                index.distinct.push_back(sorted[i]);
+                index.firstPos.push_back((uint32_t)i);
+            }
+        }
+    }
+
+    const int* keys = index.keys();
+    size_t m = index.keyCount();
+    int epsilon = EPSILON;
+
+    while (true) {
+        Level level;
+        level.epsilon = epsilon;
+        level.segments = buildSegments(keys, m, epsilon);
+        for (const Segment& s : level.segments) level.firstKeys.push_back(s.key);
+        index.levels.push_back(move(level));
+
+        const Level& built = index.levels.back();
+        if (built.segments.size() <= TOP_SEGMENTS || built.segments.size() == m) break;
+        keys = built.firstKeys.data();
+        m = built.firstKeys.size();
+        epsilon = EPSILON_INNER;
+    }
+    return index;
+}
+
+// ------------------------------------------------------------
+// Lookup
+// ------------------------------------------------------------
+// First position in [lo, hi) with keys[pos] >= target (hi if none), branch-free
+static inline size_t lowerBoundIn(const int* keys, size_t lo, size_t hi, int target)
+{
+    size_t len = hi - lo;
+    const int* base = keys + lo;
+    while (len > 1) {
+        size_t half = len / 2;
+        base = (base[half] < target) ? base + half : base;
+        len -= half;
+    }
+    size_t pos = (size_t)(base - keys);
+    return (len == 1 && *base < target) ? pos + 1 : pos;
+}
+
+/*
+    predictLowerBound()
+    -------------------
+    Segment `seg` of `level` models the array keys[0..m). Returns the first
+    position with keys[pos] >= target, searching only the error window.
+*/
+static inline size_t predictLowerBound(const Level& level, size_t seg, const int* keys, size_t m,
+                                       int target)
+{
+    const Segment& s = level.segments[seg];
+    size_t start = s.start;
+    size_t end = (seg + 1 < level.segments.size()) ? level.segments[seg + 1].start : m;
+
+    double guess = (double)start + s.slope * ((double)target - (double)s.key);
+    guess = min(max(guess, (double)start), (double)end);
+
+    size_t g = (size_t)guess;
+    size_t lo = (g > start + level.epsilon + 1) ? g - level.epsilon - 1 : start;
+    size_t hi = min(end, g + level.epsilon + 2);
+    return lowerBoundIn(keys, lo, hi, target);
+}
+
+/*
+    learnedLowerBound()
+    -------------------
+    Index of the first value >= target (n if none), like std::lower_bound.
+    An empty array has no segments to predict with: the answer is 0.
+*/
+static inline size_t learnedLowerBound(const LearnedIndex& index, int target)
+{
+    if (index.keyCount() == 0) return 0;
+    const Level& top = index.levels.back();
+
+    // Top: last segment whose first key <= target (segment 0 if none)
+    size_t seg = lowerBoundIn(top.firstKeys.data(), 0, top.firstKeys.size(), target);
+    if (seg == top.firstKeys.size() || top.firstKeys[seg] != target) seg = (seg > 0) ? seg - 1 : 0;
+
+    // Walk down: each level's segment locates the segment one level lower
+    for (size_t L = index.levels.size() - 1; L > 0; L--) {
+        const Level& below = index.levels[L - 1];
+        size_t m = below.firstKeys.size();
+        size_t pos = predictLowerBound(index.levels[L], seg, below.firstKeys.data(), m, target);
+        seg = (pos < m && below.firstKeys[pos] == target) ? pos : (pos > 0 ? pos - 1 : 0);
+    }
+
+    size_t m = index.keyCount();
+    size_t pos = predictLowerBound(index.levels[0], seg, index.keys(), m, target);
+    if (index.distinct.empty()) return pos;
+    return (pos < m) ? index.firstPos[pos] : index.data->size();
+}
+
+/*
+    learnedSearch()
+    ---------------
+    Index of target, or -1 - the same answer as binarySearch().
+*/
+static inline int learnedSearch(const LearnedIndex& index, int target)
+{
+    const vector<int>& data = *index.data;
+    size_t pos = learnedLowerBound(index, target);
+    return (pos < data.size() && data[pos] == target) ? (int)pos : -1;
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        string full = string(prefixes[i]) + filename;
+        vector<int> arr;
+        if (loadIntsFast(full, arr)) {
+            cout << "Loaded: " << full << "\n";
+            return arr;
+        }
+    }
+
+    cout << "Error reading: " << filename << "\n";
+    cout << "Missing input file — aborting.\n";
+    exit(1);
+}
+
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without the tests and main()
+// ------------------------------------------------------------
+// Test data
+// ------------------------------------------------------------
+// n distinct keys spread uniformly over [0, 2^30)
+static vector<int> uniformKeys(size_t n, mt19937_64& rng)
+{
+    double gap = (double)(1 << 30) / (double)n;
+    vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (int)(i * gap + (double)(rng() % (uint64_t)max(1.0, gap)));
+    }
+    return keys;
+}
+
+// n distinct keys in [0, 2^30) whose gaps are Pareto(1.1): mostly tiny,
+// occasionally enormous - the case a single global line gets wrong
+static vector<int> skewedKeys(size_t n, mt19937_64& rng)
+{
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    vector<double> cumulative(n);
+    double total = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        cumulative[i] = total;
+        total += pow(1.0 - unit(rng), -1.0 / 1.1) - 1.0;
+    }
+
+    double scale = ((double)(1 << 30) - (double)n) / total;
+    vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) keys[i] = (int)i + (int)(cumulative[i] * scale);
+    return keys;
+}
+
+// n sorted keys in runs of 1..maxRun equal values (runs far longer than
+// EPSILON), gaps of 1..3 between runs
+static vector<int> duplicateRunKeys(size_t n, size_t maxRun, mt19937_64& rng)
+{
+    vector<int> keys;
+    keys.reserve(n);
+    int value = -(int)n;
+    while (keys.size() < n) {
+        size_t run = min(n - keys.size(), 1 + (size_t)(rng() % maxRun));
+        keys.insert(keys.end(), run, value);
+        value += 1 + (int)(rng() % 3);
+    }
+    return keys;
+}
+
+// Half the queries present, half random in [front, back]
+static vector<int> makeQueries(const vector<int>& keys, size_t count, mt19937_64& rng)
+{
+    vector<int> q(count);
+    uint64_t span = (uint64_t)((long long)keys.back() - keys.front() + 1);
+    for (size_t i = 0; i < count; i++) {
+        q[i] = (i % 2 == 0) ? keys[rng() % keys.size()] : keys.front() + (int)(rng() % span);
+    }
+    return q;
+}
+
+// ------------------------------------------------------------
+// Tests and measurements
+// ------------------------------------------------------------
+static size_t learnedIndexBytes(const LearnedIndex& index)
+{
+    size_t bytes = 0;
+    for (const Level& level : index.levels) {
+        bytes += level.segments.size() * sizeof(Segment) + level.firstKeys.size() * sizeof(int);
+    }
+    return bytes + index.distinct.size() * sizeof(int) + index.firstPos.size() * sizeof(uint32_t);
+}
+
+static bool checkAgainstBinarySearch(const vector<int>& sorted, const LearnedIndex& index)
+{
+    if (sorted.empty()) return true;
+    for (long long x = (long long)sorted.front() - 1; x <= (long long)sorted.back() + 1; x++) {
+        int target = (int)x;
+        if (learnedSearch(index, target) != ex2::binarySearch(sorted, target)) return false;
+        size_t lb = lower_bound(sorted.begin(), sorted.end(), target) - sorted.begin();
+        if (learnedLowerBound(index, target) != lb) return false;
+    }
+    return true;
+}
+
+// Duplicates: learnedSearch() may return another copy than binarySearch(),
+// so check that both find the value, and the lower bound exactly
+static bool checkDuplicates(const vector<int>& sorted, const LearnedIndex& index)
+{
+    for (long long x = (long long)sorted.front() - 1; x <= (long long)sorted.back() + 1; x++) {
+        int target = (int)x;
+        size_t lb = lower_bound(sorted.begin(), sorted.end(), target) - sorted.begin();
+        if (learnedLowerBound(index, target) != lb) return false;
+
+        int found = learnedSearch(index, target);
+        bool present = ex2::binarySearch(sorted, target) != -1;
+        if (present ? (found != (int)lb) : (found != -1)) return false;
+    }
+    return true;
+}
+
+template <class SearchFn>
+static double lookupsPerSecond(const vector<int>& queries, size_t count, SearchFn search,
+                               long long& checksum)
+{
+    checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (size_t q = 0; q < count; q++) checksum += search(queries[q]);
+    auto t1 = chrono::steady_clock::now();
+    return count / chrono::duration<double>(t1 - t0).count();
+}
+
+static bool measure(const char* dist, const vector<int>& keys, mt19937_64& rng)
+{
+    LearnedIndex index = buildLearnedIndex(keys);
+    vector<int> queries = makeQueries(keys, 1 << 20, rng);
+    size_t all = queries.size();
+    size_t few = min(all, INTERP_MAX_QUERY);
+
+    long long sumBinary, sumLearned, sumInterp, sumInterpRef;
+    double binary  = lookupsPerSecond(queries, all, [&](int q) { return ex2::binarySearch(keys, q); }, sumBinary);
+    double interp  = lookupsPerSecond(queries, few, [&](int q) { return ex4::interpolationSearch(keys, q); }, sumInterp);
+    double learned = lookupsPerSecond(queries, all, [&](int q) { return learnedSearch(index, q); }, sumLearned);
+    lookupsPerSecond(queries, few, [&](int q) { return ex2::binarySearch(keys, q); }, sumInterpRef);
+
+    bool ok = (sumBinary == sumLearned) && (sumInterp == sumInterpRef);
+    cout << left << setw(10) << dist << right << setw(12) << keys.size()
+         << setw(14) << binary / 1e6
+         << setw(14) << interp / 1e6
+         << setw(14) << learned / 1e6
+         << setw(10) << index.levels[0].segments.size()
+         << setw(8) << index.levels.size()
+         << setw(12) << learnedIndexBytes(index) / 1024.0
+         << setw(8) << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+
+    vector<int> sorted = loadFile("ordered.txt");
+    LearnedIndex index = buildLearnedIndex(sorted);
+
+    cout << "\n=== Learned Index Tests ===\n";
+    cout << "Loaded " << sorted.size() << " integers\n";
+    cout << "Segments per level (data level first):";
+    for (const Level& level : index.levels) cout << " " << level.segments.size();
+    cout << "  (epsilon " << EPSILON << ")\n";
+
+    bool ok = checkAgainstBinarySearch(sorted, index);
+    cout << "All values and gaps vs binarySearch / lower_bound: " << (ok ? "PASS" : "FAIL") << "\n";
+
+    mt19937_64 rng(31337);
+    bool dupOk = true;
+    for (size_t maxRun : { 2, 200, 5000 }) {
+        vector<int> dups = duplicateRunKeys(200000, maxRun, rng);
+        dupOk &= checkDuplicates(dups, buildLearnedIndex(dups));
+    }
+    dupOk &= checkDuplicates(vector<int>(1000, 7), buildLearnedIndex(vector<int>(1000, 7)));
+    cout << "Duplicate runs (up to 5000 long, all equal) vs lower_bound: " << (dupOk ? "PASS" : "FAIL") << "\n";
+    ok &= dupOk;
+
+    vector<int> empty;
+    LearnedIndex emptyIndex = buildLearnedIndex(empty);
+    bool emptyOk = true;
+    for (int target : { INT_MIN, -1, 0, 1, INT_MAX }) {
+        emptyOk &= learnedLowerBound(emptyIndex, target) == 0 && learnedSearch(emptyIndex, target) == -1;
+    }
+    cout << "Empty array (lower bound 0, not found): " << (emptyOk ? "PASS" : "FAIL") << "\n";
+    ok &= emptyOk;
+
+    cout << "\n--- Million lookups per second (half present; interpolation: first "
+         << INTERP_MAX_QUERY << " queries) ---\n";
+    cout << left << setw(10) << "keys" << right << setw(12) << "n" << setw(14) << "binarySearch"
+         << setw(14) << "interpolation" << setw(14) << "learned" << setw(10) << "segments"
+         << setw(8) << "levels" << setw(12) << "index KB" << setw(8) << "check" << "\n";
+    cout << fixed << setprecision(2);
+
+    for (size_t n = 10000; n <= maxN; n *= 10) {
+        ok &= measure("uniform", uniformKeys(n, rng), rng);
+        ok &= measure("skewed", skewedKeys(n, rng), rng);
+        if (n > SIZE_MAX / 10) break;
+    }
+
+    cout << "\n" << (ok ? "SUCCESS — all searches agree!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
@@ -0,0 +1,423 @@
+/*
+    veb_search.cpp
+    --------------
+    Static binary search tree in VAN EMDE BOAS (vEB) order: a cache-
+    oblivious layout that needs no block size, compared with the sorted
+    array (binarySearch(), example 2), Eytzinger (example 17) and the
+    S-tree (example 19) as the data grows past L1, L2, L3 and into DRAM.
+
+    WHY ANOTHER LAYOUT
+    ------------------
+    Eytzinger keeps the TOP of the tree dense, but below the first few
+    levels every step is a new cache line (it hides that with prefetching).
+    The S-tree packs 16 keys per node, which is exactly right for 64-byte
+    lines - and only for those: pages (4 KB), TLB reach and L2/L3 sets are
+    other "block sizes" it knows nothing about.
+
+    VAN EMDE BOAS ORDER
+    -------------------
+    Cut a tree of height h in the middle of its levels:
+
+                     [ top tree, h/2 levels ]
+                    /      |            \
+            [bottom 1] [bottom 2] ... [bottom 2^(h/2)]   h - h/2 levels each
+
+    Store the top tree first, then every bottom tree one after another,
+    each laid out by the same rule, recursively. At SOME level of that
+    recursion the subtrees are about the size of any block B (a cache line,
+    a page, ...), and a root-to-leaf path crosses only O(log_B n) of them
+    - for every B at once. That is what "cache-oblivious" means: one
+    layout, near-optimal for every level of the hierarchy, no tuning.
+
+    NAVIGATION WITHOUT POINTERS
+    ---------------------------
+    Children are not at 2k and 2k + 1 any more. Following Brodal, Fagerberg
+    and Jacob, three small tables per depth d are precomputed, describing
+    the recursion step where depth d becomes the root of a bottom tree:
+
+        T[d]  size of the top tree above it    (2^ht - 1)
+        B[d]  size of each bottom tree         (2^hb - 1)
+        D[d]  depth of that top tree's root
+
+    Descending with the usual BFS number i (root 1, children 2i, 2i + 1):
+
+        pos[d] = pos[D[d]] + T[d] + (i & T[d]) * B[d]
+
+    (i & T[d] is which bottom tree we are in.) pos[] keeps the positions of
+    the ancestors, so each step is a few ALU operations and ONE key load.
+
+    BUILDING
+    --------
+    The tree is complete: height h = ceil(log2(n + 1)), 2^h - 1 nodes, the
+    missing ones padded with INT_MAX after every real key (same idea as the
+    S-tree padding). An in-order walk using the formula above hands out the
+    sorted values. rank[pos] maps each node back to its index in the sorted
+    array (n for padding). The padding can cost up to 2x memory.
+
+    MEASURED
+    --------
+    1) Every value and gap of ordered.txt, and every value of many small
+       sizes: same answers as binarySearch() and std::lower_bound.
+    2) Million lookups per second, 2^20 random queries, n = 2^9 .. maxN,
+       each row labelled with the cache level the sorted array fits in.
+       The structures are built one at a time to keep peak memory down.
+
+    USAGE
+    -----
+        veb_search [maxN]     (default 2^27: 512 MB of keys, ~2.5 GB peak)
+*/
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+
+// Platform-specific include for sysconf() cache sizes
+#ifndef _WIN32
+    #include <unistd.h>
+#endif
+
+#include "../common/fast_loader.hpp"
+#include "../common/sorting_networks.hpp"  // detectSimdLevel() (used by example 19)
+
+// binarySearch() (example 2), Eytzinger (example 17) and the S-tree
+// (example 19) for the comparison, each in its own namespace because every
+// file defines a loader; their main() functions are left out. Only the
+// tests use them, so they are skipped when this file is itself included.
+#ifndef SECTION12_NO_MAIN
+    #define SECTION12_NO_MAIN
+namespace ex2 {
+#include "../example_2_binary_search/binary_search.cpp"
+}
+namespace ex17 {
+#include "../example_17_eytzinger_search/eytzinger_search.cpp"
+}
+namespace ex19 {
+#include "../example_19_s_tree_search/s_tree_search.cpp"
+}
+    #undef SECTION12_NO_MAIN
+#endif
+
+using namespace std;
+
+static const int    VEB_MAX_HEIGHT = 40;        // 2^40 nodes: far beyond memory
+static const size_t VEB_NO_POS     = SIZE_MAX;  // lower bound past every key
+
+// ------------------------------------------------------------
+// Layout
+// ------------------------------------------------------------
+struct VebTree {
+    vector<int> keys;     // 2^height - 1 nodes in vEB order
+    vector<int> rank;     // rank[pos] = index in the sorted array (n = padding)
+    size_t n = 0;
+    int height = 0;
+
+    // Per depth: top tree size, bottom tree size, depth of the top tree root
+    size_t T[VEB_MAX_HEIGHT] = {};
+    size_t B[VEB_MAX_HEIGHT] = {};
+    int    D[VEB_MAX_HEIGHT] = {};
+};
+
+// Fills T/B/D for the subtree of height h whose root is at depth top
+static void vebSplit(VebTree& t, int top, int h)
+{
+    if (h <= 1) return;
+
+    int ht = h / 2;           // levels in the top tree
+    int hb = h - ht;          // levels in each bottom tree
+    int d = top + ht;         // depth of the bottom tree roots
+
+    t.T[d] = ((size_t)1 << ht) - 1;
+    t.B[d] = ((size_t)1 << hb) - 1;
+    t.D[d] = top;
+
+    vebSplit(t, top, ht);
+    vebSplit(t, d, hb);
+}
+
+// Position of the node with BFS number i at depth d (pos[0..d-1] are its ancestors)
+static inline size_t vebPosition(const VebTree& t, const size_t* pos, size_t i, int d)
+{
+    return pos[t.D[d]] + t.T[d] + (i & t.T[d]) * t.B[d];
+}
+
+// In-order walk of the implicit tree: hands out sorted[next], next = 0, 1, ...
+static size_t vebFill(VebTree& t, const vector<int>& sorted, size_t next,
+                      size_t i, int d, size_t* pos)
+{
+    if (d >= t.height) return next;
+
+    pos[d] = (d == 0) ? 0 : vebPosition(t, pos, i, d);
+    next = vebFill(t, sorted, next, 2 * i, d + 1, pos);
+
+    size_t p = pos[d];   // children never touch pos[d]
+    if (next < t.n) {
+        t.keys[p] = sorted[next];
+        t.rank[p] = (int)next;
+        next++;
+    } else {
+        t.keys[p] = INT_MAX;
+        t.rank[p] = (int)t.n;
+    }
+
+    return vebFill(t, sorted, next, 2 * i + 1, d + 1, pos);
+}
+
+/*
+    buildVeb()
+    ----------
+    Builds the layout from a sorted vector. O(n) time, fewer than 2n nodes.
+*/
+static VebTree buildVeb(const vector<int>& sorted)
+{
+    VebTree t;
+    t.n = sorted.size();
+    while ((((size_t)1 << t.height) - 1) < t.n) t.height++;
+
+    size_t nodes = ((size_t)1 << t.height) - 1;
+    t.keys.assign(nodes, INT_MAX);
+    t.rank.assign(nodes, (int)t.n);
+
+    vebSplit(t, 0, t.height);
+
+    size_t pos[VEB_MAX_HEIGHT];
+    vebFill(t, sorted, 0, 1, 0, pos);
+    return t;
+}
+
+// ------------------------------------------------------------
+// Search
+// ------------------------------------------------------------
+/*
+    vebLowerBoundPos()
+    ------------------
+    Position of the first key >= target, or VEB_NO_POS.
+*/
+static inline size_t vebLowerBoundPos(const VebTree& t, int target)
+{
+    size_t pos[VEB_MAX_HEIGHT];
+    size_t candidate = VEB_NO_POS;
+    size_t i = 1;
+
+    pos[0] = 0;
+    for (int d = 0; d < t.height; d++) {
+        if (d > 0) pos[d] = vebPosition(t, pos, i, d);
+        bool right = t.keys[pos[d]] < target;
+        candidate = right ? candidate : pos[d];
+        i = 2 * i + right;
+    }
+    return candidate;
+}
+
+/*
+    vebSearch()
+    -----------
+    Index of target in the sorted array, or -1 (same answer as binarySearch()).
+    Padding nodes hold INT_MAX too, so a match only counts if its rank is a
+    real index (< n).
+*/
+static inline int vebSearch(const VebTree& t, int target)
+{
+    size_t p = vebLowerBoundPos(t, target);
+    return (p != VEB_NO_POS && t.keys[p] == target && t.rank[p] < (int)t.n) ? t.rank[p] : -1;
+}
+
+/*
+    vebLowerBound()
+    ---------------
+    Index of the first value >= target in the sorted array (n if none),
+    like std::lower_bound.
+*/
+static inline size_t vebLowerBound(const VebTree& t, int target)
+{
+    size_t p = vebLowerBoundPos(t, target);
+    return p != VEB_NO_POS ? (size_t)t.rank[p] : t.n;
+}
+
+// ------------------------------------------------------------
+// FILE LOADER (tries several relative paths)
+// ------------------------------------------------------------
+vector<int> loadFile(const string& filename)
+{
+    const char* prefixes[] = { "", "data/", "../data/", "../../data/", nullptr };
+
+    for (int i = 0; prefixes[i] != nullptr; ++i) {
+        string full = string(prefixes[i]) + filename;
+        vector<int> arr;
+        if (loadIntsFast(full, arr)) {
+            cout << "Loaded: " << full << "\n";
+            return arr;
+        }
+    }
+
+    cout << "Error reading: " << filename << "\n";
+    cout << "Missing input file — aborting.\n";
+    exit(1);
+}
+
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without the tests and main()
+// ------------------------------------------------------------
+// Cache sizes (for labelling the rows); the defaults are used where
+// sysconf() can't report them (Windows, macOS)
+// ------------------------------------------------------------
+struct CacheSizes {
+    size_t l1 = 32 * 1024;
+    size_t l2 = 1024 * 1024;
+    size_t l3 = 32 * 1024 * 1024;
+};
+
+static CacheSizes detectCacheSizes()
+{
+    CacheSizes c;
+#if !defined(_WIN32) && defined(_SC_LEVEL1_DCACHE_SIZE) && \
+    defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l1 > 0) c.l1 = (size_t)l1;
+    if (l2 > 0) c.l2 = (size_t)l2;
+    if (l3 > 0) c.l3 = (size_t)l3;
+#endif
+    return c;
+}
+
+static const char* cacheLevel(const CacheSizes& c, size_t bytes)
+{
+    if (bytes <= c.l1) return "L1";
+    if (bytes <= c.l2) return "L2";
+    if (bytes <= c.l3) return "L3";
+    return "DRAM";
+}
+
+// ------------------------------------------------------------
+// Tests and measurements
+// ------------------------------------------------------------
+static bool agreesAt(const vector<int>& sorted, const VebTree& t, int target)
+{
+    if (vebSearch(t, target) != ex2::binarySearch(sorted, target)) return false;
+    size_t lb = lower_bound(sorted.begin(), sorted.end(), target) - sorted.begin();
+    return vebLowerBound(t, target) == lb;
+}
+
+// Every value and every gap between values, plus INT_MIN / INT_MAX (INT_MAX
+// is also the padding key): same answers as binarySearch()
+static bool checkAgainstBinarySearch(const vector<int>& sorted, const VebTree& t)
+{
+    if (!agreesAt(sorted, t, INT_MIN) || !agreesAt(sorted, t, INT_MAX)) return false;
+    if (sorted.empty()) return true;
+    for (long long x = (long long)sorted.front() - 1; x <= (long long)sorted.back() + 1; x++) {
+        if (!agreesAt(sorted, t, (int)x)) return false;
+    }
+    return true;
+}
+
+// Every size 0..maxN exercises every amount of padding and every tree height
+static bool checkSmallSizes(size_t maxN)
+{
+    for (size_t n = 0; n <= maxN; n++) {
+        vector<int> sorted(n);
+        for (size_t i = 0; i < n; i++) sorted[i] = (int)(3 * i);
+        if (!checkAgainstBinarySearch(sorted, buildVeb(sorted))) {
+            cout << "  mismatch at n = " << n << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class SearchFn>
+static double lookupsPerSecond(const vector<int>& queries, SearchFn search, long long& checksum)
+{
+    checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int q : queries) checksum += search(q);
+    auto t1 = chrono::steady_clock::now();
+    return queries.size() / chrono::duration<double>(t1 - t0).count();
+}
+
+static bool measureSize(size_t n, const CacheSizes& caches, mt19937_64& rng)
+{
+    // Distinct even keys; queries in [0, 2n): half are present
+    vector<int> sorted(n);
+    for (size_t i = 0; i < n; i++) sorted[i] = (int)(2 * i);
+
+    vector<int> queries(1 << 20);
+    for (int& q : queries) q = (int)(rng() % (2 * n));
+
+    long long sumBinary, sumEytzinger, sumSTree, sumVeb;
+    double binary = lookupsPerSecond(queries, [&](int q) { return ex2::binarySearch(sorted, q); }, sumBinary);
+
+    // One structure at a time: each is freed at the end of its block
+    double eytzinger, stree, veb;
+    {
+        ex17::Eytzinger e = ex17::buildEytzinger(sorted);
+        eytzinger = lookupsPerSecond(queries, [&](int q) { return ex17::eytzingerSearch(e, q); }, sumEytzinger);
+    }
+    {
+        ex19::STree t = ex19::buildSTree(sorted);
+        stree = lookupsPerSecond(queries, [&](int q) { return ex19::streeFind(t, q); }, sumSTree);
+    }
+    {
+        VebTree t = buildVeb(sorted);
+        veb = lookupsPerSecond(queries, [&](int q) { return vebSearch(t, q); }, sumVeb);
+    }
+
+    bool ok = (sumBinary == sumEytzinger) && (sumBinary == sumSTree) && (sumBinary == sumVeb);
+    cout << setw(12) << n
+         << setw(7) << cacheLevel(caches, n * sizeof(int))
+         << setw(14) << binary / 1e6
+         << setw(14) << eytzinger / 1e6
+         << setw(14) << stree / 1e6
+         << setw(14) << veb / 1e6
+         << setw(8) << (ok ? "OK" : "WRONG") << "\n";
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    size_t maxN = argc > 1 ? strtoull(argv[1], nullptr, 10) : ((size_t)1 << 27);
+
+    vector<int> sorted = loadFile("ordered.txt");
+    VebTree t = buildVeb(sorted);
+
+    cout << "\n=== van Emde Boas Layout Search Tests ===\n";
+    cout << "Loaded " << sorted.size() << " integers into a tree of height " << t.height
+         << " (" << t.keys.size() << " nodes)\n";
+    cout << "Top of the layout:";
+    for (size_t p = 0; p < 7 && p < t.keys.size(); p++) cout << " " << t.keys[p];
+    cout << "\n";
+
+    bool ok = checkAgainstBinarySearch(sorted, t);
+    cout << "All values and gaps vs binarySearch / lower_bound: " << (ok ? "PASS" : "FAIL") << "\n";
+    bool small = checkSmallSizes(300);
+    cout << "Every size 0..300: " << (small ? "PASS" : "FAIL") << "\n";
+    ok &= small;
+
+    CacheSizes caches = detectCacheSizes();
+    cout << "\nCaches: L1d " << caches.l1 / 1024 << " KB, L2 " << caches.l2 / 1024
+         << " KB, L3 " << caches.l3 / 1024 << " KB (level = where the sorted keys fit)\n";
+    cout << "SIMD for the S-tree: " << simdLevelName(detectSimdLevel()) << "\n";
+
+    cout << "\n--- Million lookups per second (2^20 random queries, half present) ---\n";
+    cout << setw(12) << "n" << setw(7) << "level" << setw(14) << "binarySearch"
+         << setw(14) << "eytzinger" << setw(14) << "S-tree" << setw(14) << "vEB"
+         << setw(8) << "check" << "\n";
+    cout << fixed << setprecision(2);
+
+    mt19937_64 rng(7);
+    for (size_t n = (size_t)1 << 9; n <= maxN; n *= 4) {
+        ok &= measureSize(n, caches, rng);
+    }
+
+    cout << "\n" << (ok ? "SUCCESS — all searches agree!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
+}
+#endif // SECTION12_NO_MAIN
@@ -3,6 +3,8 @@
 #include <fstream>    // Provides file stream classes (ifstream)
 #include <string>     // Provides the std::string class
 
+#include "../common/fast_loader.hpp"
+
 using namespace std;  // Allows use of standard library names without std:: prefix
 
 // =====================================================
@@ -94,19 +96,15 @@ int binarySearchSteps(const vector<int>& arr, int target, int& steps) {
  *         or an empty vector if the file cannot be opened
  */
 vector<int> load_file(const string& path) {
-    ifstream f(path);     // Open the file for reading
     vector<int> out;      // Container for loaded integers
 
-    // Validate file open
-    if (!f.is_open()) {
+    // Read integers until EOF or invalid input in one bulk pass;
+    // false means the file could not be opened
+    if (!loadIntsFast(path, out)) {
         cout << "Error reading: " << path << "\n";
         return out;       // Return empty vector on failure
     }
 
-    int x;  // Temporary variable for input
-    // Read integers until EOF or invalid input
-    while (f >> x) out.push_back(x);
-
     return out;  // Vector is returned by value (move semantics apply)
 }
 
@@ -159,6 +157,7 @@ void run_tests(const vector<int>& arr) {
  * runs binary search tests,
  * and exits.
  */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // Load sorted dataset from file
     vector<int> arr = load_file("..\\data\\ordered.txt");
@@ -174,3 +173,4 @@ int main() {
 
     return 0;  // Successful program termination
 }
+#endif // SECTION12_NO_MAIN
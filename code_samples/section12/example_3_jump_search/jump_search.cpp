@@ -3,6 +3,8 @@
 #include <fstream>   // Provides file stream classes (ifstream)
 #include <cmath>     // Provides mathematical functions such as sqrt
 
+#include "../common/fast_loader.hpp"
+
 using namespace std; // Allows use of standard library names without std:: prefix
 
 // ============================================================
@@ -136,22 +138,15 @@ int jumpSearchSteps(const vector<int>& arr, int target, int& steps) {
  *         or an empty vector on failure
  */
 vector<int> loadFile(const string& path) {
-    ifstream in(path);  // Open file for reading
     vector<int> arr;    // Container for loaded integers
 
-    // Validate file open
-    if (!in) {
+    // Read integers until EOF or invalid input in one bulk pass;
+    // false means the file could not be opened
+    if (!loadIntsFast(path, arr)) {
         cout << "Error reading: " << path << "\n";
         return arr;     // Return empty vector on failure
     }
 
-    int x;  // Temporary variable for extracted integers
-
-    // Read integers until EOF or invalid input
-    while (in >> x) {
-        arr.push_back(x);
-    }
-
     return arr; // Returned by value (move semantics apply)
 }
 
@@ -203,6 +198,7 @@ void runTests(const vector<int>& arr) {
  * Loads an ordered dataset from disk, runs jump search tests,
  * and exits.
  */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // Adjust path as needed relative to where you run the binary
     // Here: compiled & run from code_samples/section12/lesson_3_binary_search
@@ -222,3 +218,4 @@ int main() {
     runTests(ordered);
     return 0; // Successful program termination
 }
+#endif // SECTION12_NO_MAIN
@@ -1,6 +1,9 @@
 #include <iostream>  // Provides standard input/output streams (cout)
 #include <vector>    // Provides the std::vector container
 #include <fstream>   // Provides file stream classes (ifstream)
+#include <cmath>     // Provides sqrt for the guard distance
+
+#include "../common/fast_loader.hpp"
 
 using namespace std; // Allows use of standard library names without std:: prefix
 
@@ -145,6 +148,180 @@ int interpolationSearchSteps(const vector<int>& arr, int target, int& steps) {
     return -1;
 }
 
+// ============================================================
+// Adaptive Interpolation Search (guaranteed O(log n))
+// ============================================================
+//
+// Plain interpolation search can need O(n) probes: on keys like
+// 1, 2, 3, ..., 9999, 1000000000 every estimate lands at the far left and
+// each probe removes ONE element.
+//
+// The adaptive version keeps the fast case and caps the bad one:
+//
+//   1) Probe the interpolated position pos, as before.
+//   2) Probe a GUARD sqrt(width) further towards the target. If the
+//      estimate was good (typical for uniform data: its error is about
+//      sqrt(width)), the target is trapped between pos and the guard and
+//      the interval shrinks from width to ~sqrt(width).
+//   3) Check progress: if this round did not at least HALVE the interval,
+//      the data does not suit interpolation - switch to plain binary
+//      search for the rest of this lookup.
+//
+// Every interpolation round halves the interval or ends interpolation, so
+// the total is at most ~2 log2(n) probes; on uniform data it stays near
+// log log n like the original.
+
+/**
+ * Adaptive interpolation search within arr[lo..hi] (inclusive).
+ *
+ * Important:
+ *   - This function does NOT reset the step counter, so a caller can
+ *     add its own probes (see interpolationSearchFinger()).
+ *
+ * @param arr    Sorted vector of integers
+ * @param lo     Left boundary index (inclusive)
+ * @param hi     Right boundary index (inclusive)
+ * @param target Value to locate
+ * @param steps  Incremented once per element comparison
+ *
+ * @return Index of the target if found; otherwise -1
+ */
+int interpolationSearchAdaptiveRange(const vector<int>& arr, int lo, int hi,
+                                     int target, int& steps) {
+    bool useBinary = false;  // set once interpolation stops paying off
+
+    while (lo <= hi) {
+        steps += 2;  // compare target against arr[lo] and arr[hi]
+        if (target < arr[lo] || target > arr[hi]) return -1;
+
+        int width = hi - lo + 1;
+
+        if (useBinary || arr[hi] == arr[lo]) {
+            // Plain binary search step
+            int mid = lo + (hi - lo) / 2;
+            steps++;
+            if (arr[mid] == target) return mid;
+            if (arr[mid] < target) lo = mid + 1;
+            else                   hi = mid - 1;
+            continue;
+        }
+
+        // 1) Interpolated probe (64-bit math: key differences may not fit in int)
+        int pos = lo + (int)((double)(hi - lo) * ((long long)target - arr[lo]) /
+                             ((long long)arr[hi] - arr[lo]));
+        steps++;
+        if (arr[pos] == target) return pos;
+
+        // 2) Guard probe sqrt(width) beyond pos, on the target's side
+        int guard = (int)std::sqrt((double)width);
+        if (guard < 1) guard = 1;
+
+        if (arr[pos] < target) {
+            lo = pos + 1;
+            if (pos + guard < hi) {
+                steps++;
+                if (arr[pos + guard] >= target) hi = pos + guard;
+                else                            lo = pos + guard + 1;
+            }
+        } else {
+            hi = pos - 1;
+            if (pos - guard > lo) {
+                steps++;
+                if (arr[pos - guard] <= target) lo = pos - guard;
+                else                            hi = pos - guard - 1;
+            }
+        }
+
+        // 3) Progress check: less than halved -> binary search from now on
+        if (hi - lo + 1 > width / 2) useBinary = true;
+    }
+
+    return -1;
+}
+
+/**
+ * Adaptive interpolation search over the whole array (resets steps).
+ *
+ * @param arr    Sorted vector of integers
+ * @param target Value to locate
+ * @param steps  Output parameter used to record comparison count
+ *
+ * @return Index of the target if found; otherwise -1
+ */
+int interpolationSearchAdaptive(const vector<int>& arr, int target, int& steps) {
+    steps = 0;
+    if (arr.empty()) return -1;
+    return interpolationSearchAdaptiveRange(arr, 0, (int)arr.size() - 1, target, steps);
+}
+
+// ============================================================
+// Finger search: start near the previous answer
+// ============================================================
+//
+// When queries arrive sorted or clustered, the next answer is usually
+// close to the last one. Starting from index 0 (exponential search) or
+// from the whole range (binary / interpolation) ignores that.
+//
+// A finger remembers the last position. The next lookup GALLOPS from it -
+// probes finger +- 1, 2, 4, 8, ... until it passes the target - which
+// brackets the target in O(log d) probes, d = distance from the finger.
+// The adaptive search then finishes inside the bracket.
+
+struct SearchFinger {
+    int pos = 0;   // where the last search ended
+};
+
+/**
+ * Adaptive interpolation search starting from a finger (resets steps).
+ * The finger is moved to the answer (or to where target would be).
+ *
+ * @param arr    Sorted vector of integers
+ * @param target Value to locate
+ * @param finger Position hint, updated by this call
+ * @param steps  Output parameter used to record comparison count
+ *
+ * @return Index of the target if found; otherwise -1
+ */
+int interpolationSearchFinger(const vector<int>& arr, int target,
+                              SearchFinger& finger, int& steps) {
+    steps = 0;
+    int n = (int)arr.size();
+    if (n == 0) return -1;
+
+    int start = finger.pos;
+    if (start < 0) start = 0;
+    if (start > n - 1) start = n - 1;
+
+    // Gallop from the finger to a bracket [lo, hi] around target
+    int lo, hi;
+    steps++;
+    if (arr[start] < target) {
+        lo = start + 1;
+        int step = 1;
+        while (start + step < n) {
+            steps++;
+            if (arr[start + step] >= target) break;
+            lo = start + step + 1;
+            step *= 2;
+        }
+        hi = (start + step < n) ? start + step : n - 1;
+    } else {
+        hi = start;
+        int step = 1;
+        while (start - step >= 0) {
+            steps++;
+            if (arr[start - step] <= target) break;
+            hi = start - step - 1;
+            step *= 2;
+        }
+        lo = (start - step >= 0) ? start - step : 0;
+    }
+
+    int idx = interpolationSearchAdaptiveRange(arr, lo, hi, target, steps);
+    finger.pos = (idx >= 0) ? idx : (lo < n ? lo : n - 1);
+    return idx;
+}
+
 // ============================================================
 // Load integers from file into vector<int>
 // ============================================================
@@ -158,22 +335,15 @@ int interpolationSearchSteps(const vector<int>& arr, int target, int& steps) {
  *         or an empty vector if the file cannot be opened
  */
 vector<int> loadFile(const string& path) {
-    ifstream in(path);  // Open file for reading
     vector<int> arr;    // Container for loaded integers
 
-    // Validate file open
-    if (!in) {
+    // Read integers until EOF or invalid input in one bulk pass;
+    // false means the file could not be opened
+    if (!loadIntsFast(path, arr)) {
         cout << "Error reading: " << path << "\n";
         return arr;     // Return empty vector on failure
     }
 
-    int x; // Temporary input variable
-
-    // Read integers until EOF or invalid input
-    while (in >> x) {
-        arr.push_back(x);
-    }
-
     return arr; // Returned by value (move semantics apply)
 }
 
@@ -216,6 +386,47 @@ void runTests(const vector<int>& arr) {
          << ", steps=" << steps << "\n\n";
 }
 
+// ============================================================
+// Adaptive / finger tests
+// ============================================================
+
+/**
+ * Searches every value (and every gap) in arr with each method, checks
+ * the answers agree and prints the average and maximum step counts.
+ *
+ * @param name Label for the dataset
+ * @param arr  Sorted vector of distinct integers
+ */
+void compareAdaptive(const string& name, const vector<int>& arr) {
+    long long plainTotal = 0, adaptiveTotal = 0, fingerTotal = 0;
+    int plainMax = 0, adaptiveMax = 0, fingerMax = 0;
+    int searches = 0;
+    bool agree = true;
+    SearchFinger finger;
+
+    // Ascending stream of present and absent targets: what a finger is for
+    for (size_t i = 0; i < arr.size(); i++) {
+        for (int target : { arr[i], arr[i] + 1 }) {
+            int plainSteps, adaptiveSteps, fingerSteps;
+            int a = interpolationSearchSteps(arr, target, plainSteps);
+            int b = interpolationSearchAdaptive(arr, target, adaptiveSteps);
+            int c = interpolationSearchFinger(arr, target, finger, fingerSteps);
+            agree &= (a == b) && (a == c);
+
+            plainTotal += plainSteps;       plainMax = max(plainMax, plainSteps);
+            adaptiveTotal += adaptiveSteps; adaptiveMax = max(adaptiveMax, adaptiveSteps);
+            fingerTotal += fingerSteps;     fingerMax = max(fingerMax, fingerSteps);
+            searches++;
+        }
+    }
+
+    cout << name << " (" << arr.size() << " values, " << searches << " sorted queries)\n";
+    cout << "  interpolation: avg " << (double)plainTotal / searches << ", max " << plainMax << " steps\n";
+    cout << "  adaptive:      avg " << (double)adaptiveTotal / searches << ", max " << adaptiveMax << " steps\n";
+    cout << "  with finger:   avg " << (double)fingerTotal / searches << ", max " << fingerMax << " steps\n";
+    cout << "  answers agree: " << (agree ? "PASS" : "FAIL") << "\n\n";
+}
+
 // ============================================================
 // MAIN
 // ============================================================
@@ -226,6 +437,7 @@ void runTests(const vector<int>& arr) {
  * Loads an ordered dataset from disk, runs interpolation search tests,
  * and exits.
  */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // If compiled & run from: code_samples/section12/lesson_3_interpolation_search
     // then this path points to: code_samples/section12/data/ordered.txt
@@ -243,5 +455,16 @@ int main() {
     // Run interpolation search benchmarks
     runTests(arr);
 
+    // Adaptive and finger versions on the file and on an adversarial input
+    cout << "=== Adaptive Interpolation Search ===\n";
+    compareAdaptive("ordered.txt", arr);
+
+    // 0, 1, 2, ..., n-2, then one huge key: every plain estimate lands at lo
+    vector<int> skewed(10000);
+    for (int i = 0; i < (int)skewed.size(); i++) skewed[i] = i;
+    skewed.back() = 1000000000;
+    compareAdaptive("adversarial (one huge key)", skewed);
+
     return 0; // Successful program termination
 }
+#endif // SECTION12_NO_MAIN
@@ -2,7 +2,12 @@
 #include <fstream>    // File input stream (ifstream)
 #include <vector>     // Dynamic array container
 #include <string>     // std::string
-#include <cmath>      // Mathematical utilities (not strictly required here)
+#include <cmath>      // Mathematical utilities (log2 for the cost estimate)
+#include <chrono>     // Timing of the sorted-query search
+#include <random>     // Random data for the timing runs
+#include <algorithm>  // std::sort for the random query sets
+
+#include "../common/fast_loader.hpp"
 using namespace std;
 
 /* -------------------------------------------------------
@@ -48,6 +53,78 @@ int binarySearchSteps(const vector<int>& arr, int left, int right, int target, i
     return -1;
 }
 
+/* -------------------------------------------------------
+   Lower-bound helper (counts steps)
+   ------------------------------------------------------- */
+
+/**
+ * Finds the first index in [left, right + 1] whose value is >= target,
+ * assuming arr[left - 1] < target and arr[right + 1] >= target (or that
+ * those indices lie outside the array).
+ *
+ * Unlike binarySearchSteps(), it also reports WHERE a missing target
+ * would go, which searchSorted() needs to continue from.
+ *
+ * Important:
+ *   - This function does NOT reset the step counter.
+ *
+ * @param arr    Sorted vector of integers
+ * @param left   Left boundary index (inclusive)
+ * @param right  Right boundary index (inclusive)
+ * @param target Value to search for
+ * @param steps  Reference to an integer used to accumulate step count
+ *
+ * @return Index of the first element >= target
+ */
+int lowerBoundSteps(const vector<int>& arr, int left, int right, int target, int& steps) {
+    while (left <= right) {
+        steps++;  // Count this probe
+        int mid = left + (right - left) / 2;
+        if (arr[mid] < target) left = mid + 1;
+        else right = mid - 1;
+    }
+    return left;
+}
+
+/* -------------------------------------------------------
+   Range expansion (doubling), shared by both searches
+   ------------------------------------------------------- */
+
+/**
+ * Doubles a bound starting at `start` until arr[start + bound] >= target
+ * or the end of the array is passed, and reports the range the target
+ * must lie in.
+ *
+ * On return, arr[left - 1] < target (if left > start) and
+ * arr[right + 1] >= target (if right < n - 1), so a search of
+ * [left, right] finishes the job. Costs ~log2(d) comparisons, where
+ * d is the distance from start to the target.
+ *
+ * @param arr    Sorted vector of integers
+ * @param start  Index to expand from (arr[start] is not examined)
+ * @param target Value to search for
+ * @param left   Receives the left end of the range (inclusive)
+ * @param right  Receives the right end of the range (inclusive)
+ * @param steps  Reference to an integer used to accumulate step count
+ */
+void expandRange(const vector<int>& arr, int start, int target,
+                 int& left, int& right, int& steps) {
+    int n = arr.size();
+    int bound = 1;
+
+    // Double the bound while:
+    //  - start + bound is within array limits, and
+    //  - arr[start + bound] is still less than the target
+    while (bound < n - start && arr[start + bound] < target) {
+        steps++;              // Count this range-expansion comparison
+        bound *= 2;           // Exponentially increase the search bound
+    }
+
+    // Determine the final search range
+    left = start + bound / 2;
+    right = (bound < n - start) ? start + bound : n - 1;
+}
+
 /* -------------------------------------------------------
    Exponential Search (counts steps)
    ------------------------------------------------------- */
@@ -88,19 +165,8 @@ int exponentialSearch(const vector<int>& arr, int target, int& steps) {
     // ---------------------------------------------------
     // Phase 1: Exponential range expansion
     // ---------------------------------------------------
-    int bound = 1;
-
-    // Double the bound while:
-    //  - bound is within array limits, and
-    //  - arr[bound] is still less than the target
-    while (bound < n && arr[bound] < target) {
-        steps++;              // Count this range-expansion comparison
-        bound *= 2;           // Exponentially increase the search bound
-    }
-
-    // Determine the final search range for binary search
-    int left = bound / 2;
-    int right = min(bound, n - 1);
+    int left, right;
+    expandRange(arr, 0, target, left, right, steps);
 
     // ---------------------------------------------------
     // Phase 2: Binary search within the identified range
@@ -108,6 +174,73 @@ int exponentialSearch(const vector<int>& arr, int target, int& steps) {
     return binarySearchSteps(arr, left, right, target, steps);
 }
 
+/* -------------------------------------------------------
+   Sorted-query search (merge-join with galloping)
+   ------------------------------------------------------- */
+
+/**
+ * Searches for many targets at once, given in ascending order.
+ *
+ * Calling exponentialSearch() (or binary search) once per target costs
+ * O(m log n): every lookup starts from scratch, although the answer for
+ * target i + 1 can only lie at or after the answer for target i.
+ *
+ * This walks both sequences like a merge: each target gallops (the same
+ * doubling as exponentialSearch()) from where the previous one ended,
+ * then finishes with a lower-bound search in the range found. A target
+ * d positions further on costs ~2 log2(d) comparisons, and since the
+ * distances add up to at most n, the total is O(m log(n / m)): about m
+ * comparisons when the targets are dense, about log n when m is tiny.
+ *
+ * Step counting includes every comparison against arr.
+ *
+ * @param arr           Sorted vector of integers
+ * @param sortedTargets Values to search for, in ascending order
+ *                      (duplicates allowed)
+ * @param steps         Reference to an integer that will receive the step count
+ *
+ * @return For each target, its index in arr, or -1 if absent
+ */
+vector<int> searchSortedSteps(const vector<int>& arr, const vector<int>& sortedTargets, int& steps) {
+    steps = 0;
+    int n = arr.size();
+    vector<int> result(sortedTargets.size(), -1);
+
+    int pos = 0;   // every remaining target lies at index >= pos
+    for (size_t i = 0; i < sortedTargets.size() && pos < n; i++) {
+        int target = sortedTargets[i];
+
+        // Still at (or before) the current position: no movement needed
+        steps++;
+        if (arr[pos] >= target) {
+            if (arr[pos] == target) result[i] = pos;
+            continue;
+        }
+
+        // Gallop from pos, then narrow down inside the range found
+        int left, right;
+        expandRange(arr, pos, target, left, right, steps);
+        pos = lowerBoundSteps(arr, left, right, target, steps);
+
+        if (pos < n && arr[pos] == target) result[i] = pos;
+    }
+
+    return result;
+}
+
+/**
+ * Same as searchSortedSteps(), without the step count.
+ *
+ * @param arr           Sorted vector of integers
+ * @param sortedTargets Values to search for, in ascending order
+ *
+ * @return For each target, its index in arr, or -1 if absent
+ */
+vector<int> searchSorted(const vector<int>& arr, const vector<int>& sortedTargets) {
+    int steps;
+    return searchSortedSteps(arr, sortedTargets, steps);
+}
+
 /* -------------------------------------------------------
    Load integers from file
    ------------------------------------------------------- */
@@ -126,18 +259,91 @@ int exponentialSearch(const vector<int>& arr, int target, int& steps) {
  *         false if the file could not be opened
  */
 bool loadFile(const string& path, vector<int>& out) {
-    ifstream in(path);
-    if (!in.is_open()) {
+    // Read integers until EOF or failure (bulk parser)
+    if (!loadIntsFast(path, out)) {
         cerr << "Error reading: " << path << endl;
         return false;
     }
-
-    int x;
-    // Read integers until EOF or failure
-    while (in >> x) out.push_back(x);
     return true;
 }
 
+/* -------------------------------------------------------
+   Sorted-query tests
+   ------------------------------------------------------- */
+
+/**
+ * Checks searchSorted() against one exponentialSearch() per target on
+ * every value and every gap of arr, then prints the comparison counts.
+ *
+ * @param arr Sorted vector of integers
+ *
+ * @return true if every answer matches
+ */
+bool testSearchSorted(const vector<int>& arr) {
+    vector<int> targets;
+    for (long long x = (long long)arr.front() - 1; x <= (long long)arr.back() + 1; x++) {
+        targets.push_back((int)x);
+    }
+
+    int sortedSteps;
+    vector<int> found = searchSortedSteps(arr, targets, sortedSteps);
+
+    bool ok = true;
+    long long separateSteps = 0;
+    for (size_t i = 0; i < targets.size(); i++) {
+        int steps;
+        ok &= (found[i] == exponentialSearch(arr, targets[i], steps));
+        separateSteps += steps;
+    }
+
+    cout << "\nsearchSorted over " << targets.size() << " ascending targets:\n";
+    cout << "  one exponentialSearch per target: " << separateSteps << " steps\n";
+    cout << "  searchSorted:                     " << sortedSteps << " steps\n";
+    cout << "  same answers: " << (ok ? "PASS" : "FAIL") << "\n";
+    return ok;
+}
+
+/**
+ * Times m sorted random targets against an array of n even keys:
+ * searchSorted() vs one binary search per target.
+ *
+ * @param n   Array size
+ * @param m   Number of targets
+ * @param rng Random generator
+ *
+ * @return true if both methods agree
+ */
+bool timeSearchSorted(int n, int m, mt19937& rng) {
+    vector<int> arr(n);
+    for (int i = 0; i < n; i++) arr[i] = 2 * i;
+
+    vector<int> targets(m);
+    for (int& t : targets) t = (int)(rng() % (2u * n));
+    sort(targets.begin(), targets.end());
+
+    auto t0 = chrono::steady_clock::now();
+    int sortedSteps;
+    vector<int> found = searchSortedSteps(arr, targets, sortedSteps);
+    auto t1 = chrono::steady_clock::now();
+
+    vector<int> separate(m);
+    long long separateSteps = 0;
+    for (int i = 0; i < m; i++) {
+        int steps = 0;
+        separate[i] = binarySearchSteps(arr, 0, n - 1, targets[i], steps);
+        separateSteps += steps;
+    }
+    auto t2 = chrono::steady_clock::now();
+
+    double msSorted = chrono::duration<double, milli>(t1 - t0).count();
+    double msSeparate = chrono::duration<double, milli>(t2 - t1).count();
+    cout << "  n=" << n << " m=" << m
+         << ": binary per target " << separateSteps << " steps / " << msSeparate << " ms"
+         << ", searchSorted " << sortedSteps << " steps / " << msSorted << " ms"
+         << " (m*log2(n/m) = " << (long long)(m * log2((double)n / m)) << ")\n";
+    return found == separate;
+}
+
 /* -------------------------------------------------------
    MAIN TESTS
    ------------------------------------------------------- */
@@ -149,6 +355,7 @@ bool loadFile(const string& path, vector<int>& out) {
  * on a series of test values, printing both the resulting
  * index and the number of steps required.
  */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     // Path to ordered.txt relative to where this program is run
     string orderedPath = "..\\data\\ordered.txt";
@@ -179,5 +386,16 @@ int main() {
              << ", steps " << steps << endl;
     }
 
-    return 0;
+    // Many targets at once, in ascending order
+    bool ok = testSearchSorted(arr);
+
+    cout << "\nTiming (random sorted targets, half present):\n";
+    mt19937 rng(12);
+    for (int m : { 100, 10000, 1000000 }) {
+        ok &= timeSearchSorted(10000000, m, rng);
+    }
+
+    cout << "\n" << (ok ? "SUCCESS — all searches agree!" : "FAIL — see above") << "\n";
+    return ok ? 0 : 1;
 }
+#endif // SECTION12_NO_MAIN
@@ -3,6 +3,10 @@
 #include <vector>     // std::vector
 #include <string>     // std::string
 #include <algorithm>  // std::swap
+#include <functional> // std::less
+
+#include "../common/fast_loader.hpp"
+#include "../common/generic_sort.hpp"  // gsort::selectionSort does the sorting
 
 // ============================================================
 // Structure to track sorting statistics
@@ -30,19 +34,14 @@ struct SortStats {
 // and an error message is printed.
 //
 std::vector<int> loadFile(const std::string& path) {
-    std::ifstream f(path);
-    if (!f) {
+    std::vector<int> arr;
+
+    // Read integers until EOF (one bulk pass, see fast_loader.hpp)
+    if (!loadIntsFast(path, arr)) {
         std::cerr << "Error reading: " << path << "\n";
         return {};
     }
 
-    std::vector<int> arr;
-    int x;
-
-    // Read integers until EOF
-    while (f >> x)
-        arr.push_back(x);
-
     return arr;
 }
 
@@ -56,33 +55,21 @@ std::vector<int> loadFile(const std::string& path) {
 //     - Find the smallest element in the range [i, n-1]
 //     - Swap it into position i
 //
+// The loop itself is gsort::selectionSort (../common/generic_sort.hpp):
+// for each i, scan [i+1, n-1] keeping the index of the smallest value,
+// then swap it into place if it is not already there.
+//
 // Step counting:
 //   - stats.comparisons is incremented once per comparison
 //     between arr[j] and arr[minIdx]
 //   - stats.swaps is incremented only when a swap actually occurs
 //
 void selectionSort(std::vector<int>& arr, SortStats& stats) {
-    int n = (int)arr.size();
-
-    // Outer loop selects the position to fill
-    for (int i = 0; i < n; i++) {
-        int minIdx = i;
-
-        // Inner loop finds the minimum element
-        // in the unsorted suffix [i+1, n-1]
-        for (int j = i + 1; j < n; j++) {
-            stats.comparisons++;  // count every comparison
-            if (arr[j] < arr[minIdx]) {
-                minIdx = j;
-            }
-        }
+    gsort::CountStats counts;
+    gsort::selectionSort(arr.begin(), arr.end(), std::less<>(), counts);
 
-        // Swap only if a new minimum was found
-        if (minIdx != i) {
-            std::swap(arr[i], arr[minIdx]);
-            stats.swaps++;        // count actual swaps
-        }
-    }
+    stats.comparisons += counts.comparisons;
+    stats.swaps += counts.swaps;
 }
 
 // ==============================
@@ -98,6 +85,7 @@ void selectionSort(std::vector<int>& arr, SortStats& stats) {
 //   2) Prints comparison & swap counts
 //   3) Verifies result against ordered.txt
 //
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     std::string unorderedPath = "..\\data\\unordered.txt";
     std::string orderedPath   = "..\\data\\ordered.txt";
@@ -172,3 +160,4 @@ int main() {
 
     return 0;
 }
+#endif // SECTION12_NO_MAIN
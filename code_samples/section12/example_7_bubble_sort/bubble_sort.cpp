@@ -4,6 +4,10 @@
 #include <string>     // std::string paths/text
 #include <sstream>    // (not used directly here; commonly used for parsing)
 #include <algorithm>  // std::swap, std::min
+#include <functional> // std::less
+
+#include "../common/fast_loader.hpp"
+#include "../common/generic_sort.hpp"  // gsort::bubbleSort does the sorting
 
 // ------------------------------------------------------------
 // Bubble Sort with step counting
@@ -19,6 +23,10 @@
         - If we complete a pass with no swaps, the array is already sorted,
           so we can stop early.
 
+    The passes themselves are gsort::bubbleSort (../common/generic_sort.hpp),
+    which also shrinks the scanned range by one after every pass (the last
+    element is then in its final position).
+
     Step counting:
         - comparisons counts how many adjacent comparisons we perform:
               arr[i - 1] > arr[i]
@@ -30,35 +38,11 @@
         - swaps: output counter for swaps
 */
 void bubbleSort(std::vector<int>& arr, long long& comparisons, long long& swaps) {
-    // Initialize counters
-    comparisons = 0;
-    swaps = 0;
-
-    int n = (int)arr.size();
-
-    // swapped controls whether another pass is needed
-    bool swapped = true;
-
-    // Continue until we complete a pass with no swaps
-    while (swapped) {
-        swapped = false;  // assume sorted unless a swap occurs this pass
-
-        // One pass compares adjacent pairs up to index n-1
-        for (int i = 1; i < n; i++) {
-            comparisons++;  // count each adjacent comparison
-
-            // If out of order, swap adjacent elements
-            if (arr[i - 1] > arr[i]) {
-                std::swap(arr[i - 1], arr[i]);
-                swaps++;     // count actual swap
-                swapped = true;
-            }
-        }
+    gsort::CountStats counts;
+    gsort::bubbleSort(arr.begin(), arr.end(), std::less<>(), counts);
 
-        // After one full pass, the last element is in its final position
-        // so we can shrink the unsorted range.
-        n--; // last element now fixed
-    }
+    comparisons = counts.comparisons;
+    swaps = counts.swaps;
 }
 
 // ------------------------------------------------------------
@@ -77,19 +61,13 @@ void bubbleSort(std::vector<int>& arr, long long& comparisons, long long& swaps)
         - out.clear() ensures the vector is empty before filling.
 */
 bool loadFile(const std::string& path, std::vector<int>& out) {
-    std::ifstream in(path);
-    if (!in) {
-        std::cout << "Error reading: " << path << "\n";
-        return false;
-    }
-
     // Ensure output vector is empty before reading
     out.clear();
 
-    // Stream extraction reads ints until EOF or invalid token
-    int x;
-    while (in >> x) {
-        out.push_back(x);
+    // Bulk parser reads ints until EOF or invalid token
+    if (!loadIntsFast(path, out)) {
+        std::cout << "Error reading: " << path << "\n";
+        return false;
     }
     return true;
 }
@@ -145,6 +123,7 @@ int compareVectors(const std::vector<int>& a, const std::vector<int>& b) {
         - Uses relative paths "../data/..."
         - These depend on where you run the compiled program from.
 */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main() {
     std::string unorderedPath = "../data/unordered.txt";
     std::string orderedPath   = "../data/ordered.txt";
@@ -201,3 +180,4 @@ int main() {
 
     return 0;
 }
+#endif // SECTION12_NO_MAIN
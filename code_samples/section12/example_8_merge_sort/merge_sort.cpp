@@ -45,6 +45,13 @@
 #include <vector>
 #include <fstream>
 #include <string>
+#include <chrono>
+#include <functional>
+
+#include "../common/sorting_networks.hpp"
+#include "../common/fast_loader.hpp"
+#include "../common/generic_sort.hpp"  // gsort::mergeAdjacent is the merge step
+
 using namespace std;
 
 // ------------------------------------------------------------
@@ -66,12 +73,22 @@ using namespace std;
     Why count writes?
         - Merge sort’s time cost is not just comparisons; it also performs
           significant memory movement (writes), and uses extra memory (tmp).
+
+    leafKernels:
+        - Counts ranges finished by a sorting network when mergeSort() is
+          called with useNetworkLeaves = true. Each leaf adds the network's
+          comparators to `comparisons` and one write per element to `writes`.
 */
 struct Stats {
     long long comparisons = 0;
     long long writes = 0;
+    long long leafKernels = 0;
 };
 
+// Largest range handed to the sorting-network leaf kernel
+// (see ../common/sorting_networks.hpp)
+static const int NETWORK_LEAF = 32;
+
 // ------------------------------------------------------------
 // Merge Sort with step counting
 // ------------------------------------------------------------
@@ -100,55 +117,20 @@ struct Stats {
 static void merge_vec(vector<int>& arr, vector<int>& tmp,
                       int left, int mid, int right, Stats& stats)
 {
-    // i walks the left half, j walks the right half, k writes into tmp
-    int i = left, j = mid, k = left;
-
-    /*
-        Main merge loop:
-          - while both halves still have elements,
-            pick the smaller front element and write it to tmp[k]
-    */
-    while (i < mid && j < right) {
-        stats.comparisons++;                   // compare arr[i] vs arr[j]
-
-        if (arr[i] <= arr[j]) {
-            tmp[k++] = arr[i++];              // write left element to tmp
-        } else {
-            tmp[k++] = arr[j++];              // write right element to tmp
-        }
-
-        stats.writes++;                        // count the write into tmp
-    }
-
     /*
-        If anything remains in the left half, copy it into tmp.
-        (At this point, the right half is exhausted.)
+        gsort::mergeAdjacent (../common/generic_sort.hpp) does the merge:
+          - while both halves have elements, write the smaller front
+            element to tmp (ties take the left one: stable)
+          - copy whatever remains of either half to tmp
+          - copy tmp back into arr[left, right), because future merges
+            expect sorted data in `arr` (these writes are counted too)
     */
-    while (i < mid) {
-        tmp[k++] = arr[i++];
-        stats.writes++;                        // write into tmp
-    }
+    gsort::CountStats counts;
+    gsort::mergeAdjacent(arr.begin() + left, arr.begin() + mid, arr.begin() + right,
+                         tmp.data() + left, std::less<>(), counts);
 
-    /*
-        If anything remains in the right half, copy it into tmp.
-        (At this point, the left half is exhausted.)
-    */
-    while (j < right) {
-        tmp[k++] = arr[j++];
-        stats.writes++;                        // write into tmp
-    }
-
-    /*
-        Copy merged range back into the original array.
-        This is necessary because future merges expect sorted data in `arr`.
-
-        Note: This implementation counts these copy-back writes too,
-        because they are real assignments and part of merge sort’s overhead.
-    */
-    for (int p = left; p < right; p++) {
-        arr[p] = tmp[p];
-        stats.writes++;                        // write back into arr
-    }
+    stats.comparisons += counts.comparisons;
+    stats.writes += counts.writes;
 }
 
 /*
@@ -158,6 +140,9 @@ static void merge_vec(vector<int>& arr, vector<int>& tmp,
 
     Base case:
         - If the range has size 0 or 1, it's already sorted.
+        - If useNetworkLeaves and the range has at most NETWORK_LEAF
+          elements, a branch-free sorting network (AVX2 / SSE4.1 / scalar,
+          picked at runtime) sorts it in one call.
 
     Recursive case:
         - Split into two halves
@@ -165,17 +150,27 @@ static void merge_vec(vector<int>& arr, vector<int>& tmp,
         - Merge the sorted halves
 */
 static void mergeSortRec(vector<int>& arr, vector<int>& tmp,
-                         int left, int right, Stats& stats)
+                         int left, int right, Stats& stats,
+                         bool useNetworkLeaves)
 {
     // If range length <= 1, nothing to sort
     if (right - left <= 1) return;
 
+    // Small range: finish with the sorting-network leaf kernel
+    if (useNetworkLeaves && right - left <= NETWORK_LEAF) {
+        sortSmall(&arr[left], right - left);
+        stats.comparisons += networkComparators(right - left);
+        stats.writes += right - left;
+        stats.leafKernels++;
+        return;
+    }
+
     // Compute midpoint safely
     int mid = left + (right - left) / 2;
 
     // Sort left half, then right half
-    mergeSortRec(arr, tmp, left, mid, stats);
-    mergeSortRec(arr, tmp, mid, right, stats);
+    mergeSortRec(arr, tmp, left, mid, stats, useNetworkLeaves);
+    mergeSortRec(arr, tmp, mid, right, stats, useNetworkLeaves);
 
     // Merge the two sorted halves
     merge_vec(arr, tmp, left, mid, right, stats);
@@ -193,13 +188,14 @@ static void mergeSortRec(vector<int>& arr, vector<int>& tmp,
     Note:
         - `stats` is NOT reset inside this function; the caller provides a
           fresh Stats (as main() does) to start counts at zero.
+        - useNetworkLeaves = true finishes small ranges with a sorting network
 */
-void mergeSort(vector<int>& arr, Stats& stats)
+void mergeSort(vector<int>& arr, Stats& stats, bool useNetworkLeaves = false)
 {
     // tmp buffer reused for all merges (better than allocating each merge)
     vector<int> tmp(arr.size());
 
-    mergeSortRec(arr, tmp, 0, (int)arr.size(), stats);
+    mergeSortRec(arr, tmp, 0, (int)arr.size(), stats, useNetworkLeaves);
 }
 
 // ------------------------------------------------------------
@@ -215,20 +211,19 @@ void mergeSort(vector<int>& arr, Stats& stats)
         - Returns an empty vector if the file cannot be opened.
 
     Note:
-        - Using `while (in >> x)` naturally stops at EOF or invalid input.
+        - loadIntsFast() (../common/fast_loader.hpp) stops at EOF or invalid
+          input, like `while (in >> x)`, but parses the whole file in one
+          bulk pass.
 */
 vector<int> loadFile(const string& path)
 {
-    ifstream in(path);
     vector<int> arr;
 
-    if (!in.is_open()) {
+    if (!loadIntsFast(path, arr)) {
         cout << "Error reading: " << path << "\n";
         return {};
     }
 
-    int x;
-    while (in >> x) arr.push_back(x);
     return arr;
 }
 
@@ -269,6 +264,29 @@ int compareArrays(const vector<int>& a, const vector<int>& b)
     return mismatches;
 }
 
+// ------------------------------------------------------------
+// Timing helper
+// ------------------------------------------------------------
+/*
+    averageSortMicros()
+    -------------------
+    Sorts a fresh copy of `input` `reps` times and returns the average
+    wall-clock time per sort in microseconds (copying is not timed).
+*/
+static double averageSortMicros(const vector<int>& input, bool useNetworkLeaves, int reps = 50)
+{
+    double total = 0.0;
+    for (int r = 0; r < reps; r++) {
+        vector<int> arr = input;
+        Stats stats;
+        auto start = chrono::steady_clock::now();
+        mergeSort(arr, stats, useNetworkLeaves);
+        auto stop = chrono::steady_clock::now();
+        total += chrono::duration<double, micro>(stop - start).count();
+    }
+    return total / reps;
+}
+
 // ------------------------------------------------------------
 // Main Test Harness
 // ------------------------------------------------------------
@@ -282,6 +300,7 @@ int compareArrays(const vector<int>& a, const vector<int>& b)
       4) Run merge sort with step counting
       5) Print comparisons + writes
       6) Compare actual sorted output to expected
+      7) Repeat with sorting-network leaves and compare average run times
 
     Paths used:
       - "..\\data\\unordered.txt"
@@ -290,6 +309,7 @@ int compareArrays(const vector<int>& a, const vector<int>& b)
     These assume you run the executable from a lesson folder that is a sibling
     of the "data" folder (consistent with your other examples).
 */
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main()
 {
     string unorderedPath = "..\\data\\unordered.txt";
@@ -319,6 +339,9 @@ int main()
         return 1;
     }
 
+    // Keep an untouched copy for the network-leaf run below
+    vector<int> input = arr;
+
     // Stats counters start at 0 by default member initializers
     Stats stats;
 
@@ -340,5 +363,23 @@ int main()
         cout << "FAIL — mismatches found: " << mismatches << "\n";
     }
 
+    // Same input again, finishing small ranges with a sorting network
+    vector<int> leafArr = input;
+    Stats leafStats;
+    mergeSort(leafArr, leafStats, true);
+
+    cout << "\n--- Merge Sort + Network Leaves (" << simdLevelName(detectSimdLevel()) << ") ---\n";
+    cout << "Leaf kernels: " << leafStats.leafKernels << "\n";
+    cout << "Comparisons:  " << leafStats.comparisons << "\n";
+    cout << "Writes:       " << leafStats.writes << "\n";
+    cout << (compareArrays(leafArr, expected) == 0
+                ? "SUCCESS — output matches expected sorted list!\n"
+                : "FAIL — network-leaf output differs from expected\n");
+
+    cout << "\nAverage time per sort (50 runs):\n";
+    cout << "  plain:          " << averageSortMicros(input, false) << " us\n";
+    cout << "  network leaves: " << averageSortMicros(input, true) << " us\n";
+
     return 0;
 }
+#endif // SECTION12_NO_MAIN
@@ -24,6 +24,10 @@
 #include <cstdlib>
 #include <cerrno>
 #include <cstring>
+#include <functional>
+
+#include "../common/fast_loader.hpp"
+#include "../common/generic_sort.hpp"  // gsort::insertionSort does the sorting
 
 // Platform-specific includes for getcwd()
 #ifdef _WIN32
@@ -54,6 +58,10 @@ using std::vector;
 //   - Best case (already sorted): O(n)
 //   - Average / Worst case:       O(n²)
 //
+// The loop itself is gsort::insertionSort (../common/generic_sort.hpp):
+// take key = arr[i], shift the larger elements of the prefix one slot
+// right, then write key into the gap.
+//
 // Step Counting Policy:
 //   - comparisons: number of comparisons between arr[j] and key
 //   - writes: number of array writes caused by shifting or inserting
@@ -62,39 +70,11 @@ void insertionSort(vector<int>& arr,
                    long long& comparisons,
                    long long& writes)
 {
-    int n = static_cast<int>(arr.size());
-
-    // Start from the second element (index 1),
-    // because a single-element prefix is already sorted.
-    for (int i = 1; i < n; i++) {
-
-        // The value we want to insert into the sorted prefix
-        int key = arr[i];
-
-        // Index of the last element in the sorted prefix
-        int j = i - 1;
-
-        // Shift elements to the right while they are greater than key
-        while (j >= 0) {
-
-            // Count the comparison arr[j] > key
-            comparisons++;
+    gsort::CountStats counts;
+    gsort::insertionSort(arr.begin(), arr.end(), std::less<>(), counts);
 
-            if (arr[j] > key) {
-                // Shift arr[j] one position to the right
-                arr[j + 1] = arr[j];
-                writes++;          // count the write
-                j--;
-            } else {
-                // Correct insertion point found
-                break;
-            }
-        }
-
-        // Insert key into its correct position
-        arr[j + 1] = key;
-        writes++;                  // count the insertion write
-    }
+    comparisons += counts.comparisons;
+    writes += counts.writes;
 }
 
 // ============================================================
@@ -173,14 +153,10 @@ bool loadFile(const string& logicalName,
         return false;
     }
 
-    // Read integers until EOF
+    // Read integers until EOF (bulk parser on the path that opened)
+    in.close();
     out.clear();
-    int x;
-    while (in >> x) {
-        out.push_back(x);
-    }
-
-    return true;
+    return loadIntsFast(usedPath, out);
 }
 
 // ============================================================
@@ -190,6 +166,7 @@ bool loadFile(const string& logicalName,
 // Loads input files, runs insertion sort, prints step counts,
 // and verifies correctness.
 //
+#ifndef SECTION12_NO_MAIN  // benchmark/benchmark.cpp includes this file without main()
 int main()
 {
     vector<int> unordered;   // unsorted input
@@ -257,3 +234,4 @@ int main()
 
     return 0;
 }
+#endif // SECTION12_NO_MAIN
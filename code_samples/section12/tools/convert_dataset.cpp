@@ -0,0 +1,131 @@
+/*
+    convert_dataset.cpp
+    -------------------
+    Converts a whitespace-separated text file of integers (ordered.txt,
+    unordered.txt, ...) to the binary format in ../common/binary_dataset.hpp,
+    reads the result back and checks it matches.
+
+    USAGE
+    -----
+        convert_dataset [--int64] [--delta] input.txt output.bin
+            --int64   8-byte elements (default 4; values must fit int32)
+            --delta   delta + varint encoding (best for sorted data)
+
+        convert_dataset --info file.bin
+            print the header
+
+    EXAMPLE (from this folder)
+    -------
+        convert_dataset ../data/unordered.txt ../data/unordered.bin
+        convert_dataset --delta ../data/ordered.txt ../data/ordered.bin
+        ../benchmark/benchmark --data ../data/unordered.bin
+
+    BUILD (from this folder)
+    -----
+        g++ -std=c++17 -O2 convert_dataset.cpp -o convert_dataset
+*/
+
+#include <climits>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../common/binary_dataset.hpp"
+
+using namespace std;
+
+static int printInfo(const string& path)
+{
+    bindata::MappedDataset data;
+    string error;
+    if (!data.open(path, &error)) {
+        cerr << path << ": " << error << "\n";
+        return 1;
+    }
+
+    const bindata::Header& h = data.header();
+    cout << path << "\n"
+         << "  encoding:      " << (h.encoding == bindata::RAW ? "raw" : "delta+varint") << "\n"
+         << "  element bytes: " << (int)h.elemBytes << "\n"
+         << "  count:         " << h.count << "\n"
+         << "  payload bytes: " << h.payloadBytes << "\n";
+    if (h.count > 0) {
+        cout << "  bytes/value:   " << (double)h.payloadBytes / (double)h.count << "\n";
+    }
+    return 0;
+}
+
+// Writes, re-opens and compares; T is int32_t or int64_t
+template <class T>
+static bool convert(const vector<long long>& values, const string& outPath,
+                    bindata::Encoding encoding)
+{
+    vector<T> typed(values.begin(), values.end());
+    string error;
+    if (!bindata::writeDataset(outPath, typed, encoding, &error)) {
+        cerr << error << "\n";
+        return false;
+    }
+
+    bindata::MappedDataset check;
+    vector<T> back;
+    if (!check.open(outPath, &error) || !check.decode(back, &error)) {
+        cerr << outPath << ": " << error << "\n";
+        return false;
+    }
+    if (back != typed) {
+        cerr << outPath << ": read-back does not match the input\n";
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    bool int64 = false;
+    bool delta = false;
+    vector<string> paths;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--info" && i + 1 < argc) return printInfo(argv[i + 1]);
+        if      (arg == "--int64") int64 = true;
+        else if (arg == "--delta") delta = true;
+        else paths.push_back(arg);
+    }
+
+    if (paths.size() != 2) {
+        cerr << "usage: convert_dataset [--int64] [--delta] input.txt output.bin\n"
+                "       convert_dataset --info file.bin\n";
+        return 2;
+    }
+
+    ifstream in(paths[0]);
+    if (!in.is_open()) {
+        cerr << "Error reading: " << paths[0] << "\n";
+        return 1;
+    }
+
+    vector<long long> values;
+    long long x;
+    while (in >> x) {
+        if (!int64 && (x < INT_MIN || x > INT_MAX)) {
+            cerr << "Value " << x << " does not fit int32 - use --int64\n";
+            return 1;
+        }
+        values.push_back(x);
+    }
+    if (!in.eof()) {
+        cerr << "Stopped at a non-integer after " << values.size() << " values\n";
+        return 1;
+    }
+
+    bindata::Encoding encoding = delta ? bindata::DELTA_VARINT : bindata::RAW;
+    bool ok = int64 ? convert<int64_t>(values, paths[1], encoding)
+                    : convert<int32_t>(values, paths[1], encoding);
+    if (!ok) return 1;
+
+    cout << "Converted " << values.size() << " values: " << paths[0] << " -> " << paths[1] << "\n";
+    return printInfo(paths[1]);
+}
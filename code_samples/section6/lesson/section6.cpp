@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 #include <stdexcept>
+#include <algorithm>  // std::min for the last (partial) group of children
 
 // ==========================
 // MIN-HEAP (INSERT ONLY)
@@ -121,6 +122,132 @@ private:
     std::vector<int> data_;
 };
 
+// ==========================
+// INDEXED 4-ARY MIN-HEAP (WITH DECREASE-KEY)
+// ==========================
+//
+// A min-heap of ITEMS 0..capacity-1, each with an int key, that can change
+// an item's key in place. This is what Dijkstra and Prim need: "vertex v
+// just got a smaller distance". Without decreaseKey() the usual trick is
+// to push v again and skip the stale copy later, which lets the heap grow
+// to one entry per EDGE instead of one per vertex.
+//
+// Two changes from MinHeapWithExtract:
+//
+// 1) Position tracking: pos_[item] = index of item in heap_ (-1 if not in
+//    the heap), updated on every move. decreaseKey(item) finds the item in
+//    O(1) and heapifies it up from there.
+//
+// 2) Four children per node instead of two:
+//        children of i = 4i + 1 .. 4i + 4,   parent of i = (i - 1) / 4
+//    The tree is half as deep (log4 n levels), so heapify-up - used by
+//    insert AND decreaseKey, the common operations in Dijkstra - does half
+//    as many steps. Heapify-down compares 4 children per level, but they
+//    sit next to each other in memory (one cache line for 4 ints).
+//
+// Moves use a "hole" instead of swaps: the moving item is held aside while
+// the others shift into the hole, and written once at the end.
+class IndexedMinHeap4 {
+public:
+    // Items are 0..capacity-1; the heap starts empty.
+    explicit IndexedMinHeap4(int capacity)
+        : keys_(capacity), pos_(capacity, -1) {}
+
+    bool empty() const { return heap_.empty(); }
+    int size() const { return (int)heap_.size(); }
+
+    // Is item currently in the heap?
+    bool contains(int item) const { return pos_[item] != -1; }
+
+    // Current key of an item in the heap.
+    int key(int item) const { return keys_[item]; }
+
+    // Add an item that is not in the heap yet.
+    // Throws if the item is already in the heap.
+    void insert(int item, int key) {
+        if (contains(item)) {
+            throw std::runtime_error("item already in heap");
+        }
+        keys_[item] = key;
+        heap_.push_back(item);
+        heapifyUp((int)heap_.size() - 1, item);
+    }
+
+    // Lower the key of an item in the heap.
+    // Throws if the item is absent or newKey is larger than its key.
+    void decreaseKey(int item, int newKey) {
+        if (!contains(item) || newKey > keys_[item]) {
+            throw std::runtime_error("invalid decreaseKey");
+        }
+        keys_[item] = newKey;
+        heapifyUp(pos_[item], item);
+    }
+
+    // Remove and return the item with the smallest key.
+    // Throws if the heap is empty.
+    int extractMin() {
+        if (heap_.empty()) {
+            throw std::runtime_error("heap underflow");
+        }
+
+        int minItem = heap_.front();
+        pos_[minItem] = -1;
+
+        // Move the last item into the root's hole and heapify it down
+        int last = heap_.back();
+        heap_.pop_back();
+        if (!heap_.empty()) {
+            heapifyDown(0, last);
+        }
+        return minItem;
+    }
+
+private:
+    static const int D = 4;  // children per node
+
+    // Place item at index i, moving larger ancestors down into the hole.
+    void heapifyUp(int i, int item) {
+        int k = keys_[item];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (keys_[heap_[parent]] <= k) break;
+            heap_[i] = heap_[parent];   // parent moves down into the hole
+            pos_[heap_[i]] = i;
+            i = parent;
+        }
+        heap_[i] = item;
+        pos_[item] = i;
+    }
+
+    // Place item at index i, moving smaller children up into the hole.
+    void heapifyDown(int i, int item) {
+        int n = (int)heap_.size();
+        int k = keys_[item];
+        while (true) {
+            int first = D * i + 1;      // first child
+            if (first >= n) break;
+
+            // Smallest of up to D children
+            int best = first;
+            int end = std::min(first + D, n);
+            for (int c = first + 1; c < end; c++) {
+                if (keys_[heap_[c]] < keys_[heap_[best]]) best = c;
+            }
+
+            if (k <= keys_[heap_[best]]) break;
+            heap_[i] = heap_[best];     // child moves up into the hole
+            pos_[heap_[i]] = i;
+            i = best;
+        }
+        heap_[i] = item;
+        pos_[item] = i;
+    }
+
+    std::vector<int> heap_;  // items in 4-ary heap order
+    std::vector<int> keys_;  // keys_[item]
+    std::vector<int> pos_;   // pos_[item] = index in heap_, or -1
+};
+
 // ==========================
 // HEAPIFY DOWN (ARRAY VERSION)
 // ==========================
@@ -196,6 +323,7 @@ void heapsortDescMinHeap(std::vector<int>& a) {
 // TEST HARNESS
 // ==========================
 
+#ifndef SECTION6_NO_MAIN  // section11 problem11_4 includes this file without main()
 int main() {
     // ---------- Test MinHeap::insert (no extract) ----------
     std::cout << "=== Testing MinHeap::insert ===\n";
@@ -268,7 +396,42 @@ int main() {
 
     std::cout << "After heapsortDescMinHeap (descending): ";
     for (int x : arr2) std::cout << x << " ";
+    std::cout << "\n\n";
+
+    // ---------- Test IndexedMinHeap4 (insert / decreaseKey / extractMin) ----------
+    std::cout << "=== Testing IndexedMinHeap4 ===\n";
+
+    // Items 0..6 with keys = arr2 values, then lower two keys in place
+    IndexedMinHeap4 h3(7);
+    for (int item = 0; item < 7; item++) {
+        h3.insert(item, arr2[item]);
+    }
+    std::cout << "Keys: ";
+    for (int item = 0; item < 7; item++) std::cout << item << ":" << h3.key(item) << " ";
     std::cout << "\n";
 
+    h3.decreaseKey(0, 2);    // item 0: 34 -> 2
+    h3.decreaseKey(5, 0);    // item 5: 3 -> 0
+    std::cout << "After decreaseKey(0, 2) and decreaseKey(5, 0)\n";
+
+    // Extract everything; keys must come out in ascending order
+    std::cout << "Extracting (item:key): ";
+    while (!h3.empty()) {
+        int item = h3.extractMin();
+        std::cout << item << ":" << h3.key(item) << " ";
+    }
+    std::cout << "\n";
+
+    // Heap stays one entry per item: re-inserting a present item is rejected
+    IndexedMinHeap4 h4(2);
+    h4.insert(1, 10);
+    try {
+        h4.insert(1, 5);
+        std::cout << "Duplicate insert accepted (unexpected)\n";
+    } catch (const std::runtime_error&) {
+        std::cout << "Duplicate insert rejected, size stays " << h4.size() << "\n";
+    }
+
     return 0;
 }
+#endif // SECTION6_NO_MAIN